@@ -5,12 +5,10 @@
 #include <vector>
 #include <cstddef>
 #include <type_traits>
+#include "slice_index.h"
+#include "slice_nd.h"
 
 // Template declarations
-template <typename T>
-typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, size_t>::type
-normalize_slice_index(T index, size_t dim_size);
-
 template <typename T>
 typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
 slice_3d_optimized(const std::vector<T>& data_1d,
@@ -19,6 +17,16 @@ slice_3d_optimized(const std::vector<T>& data_1d,
                    int start1, int stop1,
                    int start2, int stop2);
 
+// Stepped variant: data[start0:stop0:step0, start1:stop1:step1, start2:stop2:step2]
+// with exact NumPy semantics (negative steps, SLICE_NONE for omitted bounds).
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_optimized(const std::vector<T>& data_1d,
+                   size_t dim0, size_t dim1, size_t dim2,
+                   int start0, int stop0, int step0,
+                   int start1, int stop1, int step1,
+                   int start2, int stop2, int step2);
+
 template <typename T>
 typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
 slice_3d_last_dim_from(const std::vector<T>& data_1d,
@@ -3,6 +3,7 @@
 #define SLICE_3D_TPP
 
 #include "slice_3d.h"
+#include "slice_nd.h"
 #include <algorithm>
 #include <stdexcept>
 #include <cstring>
@@ -10,27 +11,16 @@
 #include <iostream>
 #include <fstream>
 #include <string>
-#include <sstream>
+#include <cstdlib>
+#include <cerrno>
+#include <limits>
 #include <iomanip> // For std::setprecision
 
-// --- Helper for index normalization ---
-// Handles ALL negative indices, including -1, according to Python rules.
-// -1 means the last element, -2 the second to last, etc.
-template <typename T>
-typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, size_t>::type
-normalize_slice_index(T index, size_t dim_size) {
-    if (index < 0) {
-        // In Python, negative indices are relative to the end.
-        // e.g., -1 is the last element, -2 is second to last.
-        // We clamp the result to be >= 0.
-        return static_cast<size_t>(std::max(static_cast<T>(0), static_cast<T>(dim_size) + index));
-    } else {
-        // Clamp positive indices to dim_size (Python allows index==dim_size for stop)
-        return static_cast<size_t>(std::min(static_cast<size_t>(index), dim_size));
-    }
-}
-
 // --- Main optimized slicing function ---
+// Thin wrapper over SliceNdPlan<3>: axis coalescing turns every pattern that
+// used to need a hand-written fast path (data[a:b, :, :], data[:, a:b, :],
+// data[:, :, a:b]) and also e.g. data[a:b, c:d, :] into one bulk copy per
+// outer index.
 template <typename T>
 typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
 slice_3d_optimized(const std::vector<T>& data_1d,
@@ -38,132 +28,29 @@ slice_3d_optimized(const std::vector<T>& data_1d,
                    int start0, int stop0,
                    int start1, int stop1,
                    int start2, int stop2) {
+    return slice_3d_optimized(data_1d, dim0, dim1, dim2,
+                              start0, stop0, 1,
+                              start1, stop1, 1,
+                              start2, stop2, 1);
+}
 
-    // --- Input Validation ---
-    const size_t total_elements = dim0 * dim1 * dim2;
-    if (data_1d.size() != total_elements) {
+// --- Stepped slicing ---
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_optimized(const std::vector<T>& data_1d,
+                   size_t dim0, size_t dim1, size_t dim2,
+                   int start0, int stop0, int step0,
+                   int start1, int stop1, int step1,
+                   int start2, int stop2, int step2) {
+    const SliceNdPlan<3> plan({dim0, dim1, dim2},
+                              {start0, start1, start2},
+                              {stop0, stop1, stop2},
+                              {step0, step1, step2});
+    if (data_1d.size() != plan.input_size()) {
         throw std::invalid_argument("Data size does not match provided dimensions.");
     }
-
-    // --- Normalize ALL Indices using the same logic ---
-    // This correctly handles ALL negative indices, including stop==-1.
-    // There is NO special case for stop==-1 anymore.
-    const size_t norm_start0 = normalize_slice_index(start0, dim0);
-    const size_t norm_stop0 = normalize_slice_index(stop0, dim0); // Treat -1 as "last element index"
-
-    const size_t norm_start1 = normalize_slice_index(start1, dim1);
-    const size_t norm_stop1 = normalize_slice_index(stop1, dim1); // Treat -1 as "last element index"
-
-    const size_t norm_start2 = normalize_slice_index(start2, dim2);
-    const size_t norm_stop2 = normalize_slice_index(stop2, dim2); // Treat -1 as "last element index"
-
-    // --- Calculate Final Slice Boundaries ---
-    // Ensure start <= stop (handles user errors like [5:3] and empty slices like [3:3])
-    // Python slicing returns an empty list if start >= stop.
-    // const size_t final_start0 = std::min(norm_start0, norm_stop0);
-    // const size_t final_stop0 = std::max(norm_start0, norm_stop0); // Ensure stop >= start
-
-    // const size_t final_start1 = std::min(norm_start1, norm_stop1);
-    // const size_t final_stop1 = std::max(norm_start1, norm_stop1); // Ensure stop >= start
-
-    // const size_t final_start2 = std::min(norm_start2, norm_stop2);
-    // const size_t final_stop2 = std::max(norm_start2, norm_stop2); // Ensure stop >= start
-
-    // --- Calculate Effective Slice Lengths ---
-    const size_t final_start0 = norm_start0;
-    const size_t final_stop0 = norm_stop0;
-    const size_t slice_len0 = (final_start0 < final_stop0) ? (final_stop0 - final_start0) : 0;
-
-    const size_t final_start1 = norm_start1;
-    const size_t final_stop1 = norm_stop1;
-    const size_t slice_len1 = (final_start1 < final_stop1) ? (final_stop1 - final_start1) : 0;
-
-    const size_t final_start2 = norm_start2;
-    const size_t final_stop2 = norm_stop2;
-    const size_t slice_len2 = (final_start2 < final_stop2) ? (final_stop2 - final_start2) : 0;
-
-    // --- Handle Empty Result ---
-    if (slice_len0 == 0 || slice_len1 == 0 || slice_len2 == 0) {
-        return std::vector<T>();
-    }
-
-    // --- Calculate Result Size ---
-    const size_t result_size = slice_len0 * slice_len1 * slice_len2;
-    std::vector<T> result_1d(result_size);
-
-    // --- Calculate Strides (Row-Major Order) ---
-    const size_t stride_dim2 = 1;
-    const size_t stride_dim1 = dim2 * stride_dim2;
-    const size_t stride_dim0 = dim1 * stride_dim1;
-
-    // --- Optimization Strategy ---
-
-    // 1. Slice only in the last dimension (dim2)
-    // Pattern: data[:, :, start2:stop2]
-    if (slice_len0 == dim0 && slice_len1 == dim1) {
-        const size_t elements_to_copy_per_row = slice_len2;
-        size_t result_idx = 0;
-        for (size_t n = 0; n < dim0; ++n) {
-            for (size_t c = 0; c < dim1; ++c) {
-                const size_t src_start_idx = n * stride_dim0 + c * stride_dim1 + final_start2;
-                std::copy(data_1d.data() + src_start_idx,
-                          data_1d.data() + src_start_idx + elements_to_copy_per_row,
-                          result_1d.data() + result_idx);
-                result_idx += elements_to_copy_per_row;
-            }
-        }
-        return result_1d;
-    }
-
-    // 2. Slice only in the middle dimension (dim1) and full last dimension (dim2)
-    // Pattern: data[:, start1:stop1, :] (when start2==0 && stop2==dim2 implicitly)
-    if (slice_len0 == dim0 && slice_len2 == dim2) {
-        // Check if the slice on dim2 is indeed the full dimension
-        if (final_start2 == 0 && final_stop2 == dim2) {
-             const size_t elements_to_copy_per_n_block = slice_len1 * dim2;
-             size_t result_idx = 0;
-             for (size_t n = 0; n < dim0; ++n) {
-                 const size_t src_start_idx = n * stride_dim0 + final_start1 * stride_dim1;
-                 std::copy(data_1d.data() + src_start_idx,
-                           data_1d.data() + src_start_idx + elements_to_copy_per_n_block,
-                           result_1d.data() + result_idx);
-                 result_idx += elements_to_copy_per_n_block;
-             }
-             return result_1d;
-        }
-        // If slicing dim2 too in a non-optimized way, fall through to general case.
-    }
-
-    // 3. Slice only in the first dimension (dim0) and full middle/last dimensions
-    // Pattern: data[start0:stop0, :, :] (when start1==0, stop1==dim1, start2==0, stop2==dim2 implicitly)
-    if (slice_len1 == dim1 && slice_len2 == dim2) {
-        // Check if the slices on dim1 and dim2 are indeed the full dimensions
-        if (final_start1 == 0 && final_stop1 == dim1 &&
-            final_start2 == 0 && final_stop2 == dim2) {
-             const size_t elements_to_copy = slice_len0 * dim1 * dim2;
-             const size_t src_start_idx = final_start0 * stride_dim0;
-             std::copy(data_1d.data() + src_start_idx,
-                       data_1d.data() + src_start_idx + elements_to_copy,
-                       result_1d.data());
-             return result_1d;
-        }
-        // If slicing dim1 or dim2 too, fall through to general case.
-    }
-
-    // --- General Case (Fallback for complex or non-contiguous slices) ---
-    // This handles all other cases.
-    size_t result_idx = 0;
-    for (size_t n = final_start0; n < final_stop0; ++n) {
-        const size_t base_offset_n = n * stride_dim0;
-        for (size_t c = final_start1; c < final_stop1; ++c) {
-            const size_t base_offset_nc = base_offset_n + c * stride_dim1;
-            for (size_t l = final_start2; l < final_stop2; ++l) {
-                const size_t original_index = base_offset_nc + l * stride_dim2;
-                result_1d[result_idx++] = data_1d[original_index];
-            }
-        }
-    }
-
+    std::vector<T> result_1d(plan.output_size());
+    plan.execute(data_1d.data(), result_1d.data());
     return result_1d;
 }
 
@@ -218,9 +105,11 @@ void save_vector_to_file(const std::vector<T>& vec, const std::string& filename)
     if (!file.is_open()) {
         throw std::runtime_error("Could not open file for writing: " + filename);
     }
-    file << std::fixed << std::setprecision(10); // Set precision for floats
+    // Enough significant digits for floats to round-trip exactly. For large
+    // arrays prefer save_npy / save_vector_to_binary (slice_io.h).
+    file << std::setprecision(std::numeric_limits<T>::max_digits10);
     for (size_t i = 0; i < vec.size(); ++i) {
-        file << vec[i];
+        file << +vec[i];  // Promote 1-byte integers so they print as numbers.
         if (i < vec.size() - 1) {
             file << "\n"; // Newline separated
         }
@@ -228,6 +117,42 @@ void save_vector_to_file(const std::vector<T>& vec, const std::string& filename)
     file.close();
 }
 
+namespace slice_3d_detail {
+
+// One whitespace-free token as T. Floating-point tokens go through strtold so
+// that the "nan" / "inf" written by save_vector_to_file read back; integers
+// are parsed as numbers (also for 1-byte types) and range-checked. Trailing
+// garbage is an error.
+template<typename T>
+T parse_text_value(const std::string& token, const std::string& filename) {
+    const char* first = token.c_str();
+    char* end = nullptr;
+    errno = 0;
+    T value{};
+    bool ok;
+    if (std::is_floating_point<T>::value) {
+        value = static_cast<T>(std::strtold(first, &end));
+        ok = true;
+    } else if (std::is_signed<T>::value) {
+        const long long parsed = std::strtoll(first, &end, 10);
+        ok = parsed >= static_cast<long long>(std::numeric_limits<T>::min()) &&
+             parsed <= static_cast<long long>(std::numeric_limits<T>::max());
+        value = static_cast<T>(parsed);
+    } else {
+        const unsigned long long parsed = std::strtoull(first, &end, 10);
+        ok = token[0] != '-' && parsed <= static_cast<unsigned long long>(std::numeric_limits<T>::max());
+        value = static_cast<T>(parsed);
+    }
+    // Floating-point ERANGE (overflow to inf, underflow) is accepted as rounding.
+    ok = ok && end == first + token.size() && (std::is_floating_point<T>::value || errno != ERANGE);
+    if (!ok) {
+        throw std::runtime_error("Could not parse value '" + token + "' in file: " + filename);
+    }
+    return value;
+}
+
+} // namespace slice_3d_detail
+
 // --- Utility to load vector from file ---
 template<typename T>
 std::vector<T> load_vector_from_file(const std::string& filename) {
@@ -235,15 +160,14 @@ std::vector<T> load_vector_from_file(const std::string& filename) {
     if (!file.is_open()) {
         throw std::runtime_error("Could not open file for reading: " + filename);
     }
+    // Whitespace-separated values; blank lines are skipped.
     std::vector<T> vec;
-    std::string line;
-    while(std::getline(file, line)) {
-        if (!line.empty()) {
-             std::stringstream ss(line);
-             T value;
-             ss >> value;
-             vec.push_back(value);
-        }
+    std::string token;
+    while (file >> token) {
+        vec.push_back(slice_3d_detail::parse_text_value<T>(token, filename));
+    }
+    if (!file.eof()) {
+        throw std::runtime_error("Failed reading file: " + filename);
     }
     file.close();
     return vec;
@@ -0,0 +1,58 @@
+// src/slice_3d_parallel.h
+#ifndef SLICE_3D_PARALLEL_H
+#define SLICE_3D_PARALLEL_H
+
+#include "slice_3d.h"
+#include "slice_plan.h"
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+// Multithreaded overloads of the slice functions in slice_3d.h. Same
+// arguments plus a ParallelPolicy; the output is split across threads and
+// the result is bit-identical to the serial versions. Outputs smaller than
+// policy.min_parallel_bytes are copied serially.
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_optimized(const std::vector<T>& data_1d,
+                   size_t dim0, size_t dim1, size_t dim2,
+                   int start0, int stop0,
+                   int start1, int stop1,
+                   int start2, int stop2,
+                   const ParallelPolicy& policy);
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_optimized(const std::vector<T>& data_1d,
+                   size_t dim0, size_t dim1, size_t dim2,
+                   int start0, int stop0, int step0,
+                   int start1, int stop1, int step1,
+                   int start2, int stop2, int step2,
+                   const ParallelPolicy& policy);
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_last_dim_from(const std::vector<T>& data_1d,
+                       size_t dim0, size_t dim1, size_t dim2,
+                       int start2,
+                       const ParallelPolicy& policy);
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_last_dim_last_n(const std::vector<T>& data_1d,
+                         size_t dim0, size_t dim1, size_t dim2,
+                         size_t n,
+                         const ParallelPolicy& policy);
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_last_dim_range(const std::vector<T>& data_1d,
+                        size_t dim0, size_t dim1, size_t dim2,
+                        int start2, int stop2,
+                        const ParallelPolicy& policy);
+
+// Include the implementation for templates
+#include "slice_3d_parallel.tpp"
+
+#endif // SLICE_3D_PARALLEL_H
@@ -0,0 +1,78 @@
+// src/slice_3d_parallel.tpp
+#ifndef SLICE_3D_PARALLEL_TPP
+#define SLICE_3D_PARALLEL_TPP
+
+#include "slice_3d_parallel.h"
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_optimized(const std::vector<T>& data_1d,
+                   size_t dim0, size_t dim1, size_t dim2,
+                   int start0, int stop0,
+                   int start1, int stop1,
+                   int start2, int stop2,
+                   const ParallelPolicy& policy) {
+    const SlicePlan plan(dim0, dim1, dim2, start0, stop0, start1, stop1, start2, stop2);
+    std::vector<T> result_1d;
+    plan.execute(data_1d, result_1d, policy);
+    return result_1d;
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_optimized(const std::vector<T>& data_1d,
+                   size_t dim0, size_t dim1, size_t dim2,
+                   int start0, int stop0, int step0,
+                   int start1, int stop1, int step1,
+                   int start2, int stop2, int step2,
+                   const ParallelPolicy& policy) {
+    const SlicePlan plan(dim0, dim1, dim2,
+                         start0, stop0, step0,
+                         start1, stop1, step1,
+                         start2, stop2, step2);
+    std::vector<T> result_1d;
+    plan.execute(data_1d, result_1d, policy);
+    return result_1d;
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_last_dim_from(const std::vector<T>& data_1d,
+                       size_t dim0, size_t dim1, size_t dim2,
+                       int start2,
+                       const ParallelPolicy& policy) {
+    return slice_3d_optimized(data_1d, dim0, dim1, dim2,
+                              0, static_cast<int>(dim0),
+                              0, static_cast<int>(dim1),
+                              start2, static_cast<int>(dim2),
+                              policy);
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_last_dim_last_n(const std::vector<T>& data_1d,
+                         size_t dim0, size_t dim1, size_t dim2,
+                         size_t n,
+                         const ParallelPolicy& policy) {
+    int start2 = (n >= dim2) ? 0 : static_cast<int>(dim2 - n);
+    return slice_3d_optimized(data_1d, dim0, dim1, dim2,
+                              0, static_cast<int>(dim0),
+                              0, static_cast<int>(dim1),
+                              start2, static_cast<int>(dim2),
+                              policy);
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_3d_last_dim_range(const std::vector<T>& data_1d,
+                        size_t dim0, size_t dim1, size_t dim2,
+                        int start2, int stop2,
+                        const ParallelPolicy& policy) {
+    return slice_3d_optimized(data_1d, dim0, dim1, dim2,
+                              0, static_cast<int>(dim0),
+                              0, static_cast<int>(dim1),
+                              start2, stop2,
+                              policy);
+}
+
+#endif // SLICE_3D_PARALLEL_TPP
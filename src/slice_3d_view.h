@@ -0,0 +1,109 @@
+// src/slice_3d_view.h
+#ifndef SLICE_3D_VIEW_H
+#define SLICE_3D_VIEW_H
+
+#include "slice_3d.h"
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+// Non-owning strided view over a row-major 3D array stored in 1D.
+// A view never copies: it only records the origin pointer, the per-axis
+// lengths and the per-axis strides (in elements). Sub-views of views compose
+// by adjusting those three, so any chain of slices stays zero-copy until
+// materialize() is called. The viewed storage must outlive the view.
+template <typename T>
+class Slice3DView {
+    static_assert(std::is_arithmetic<T>::value, "Slice3DView requires an arithmetic element type.");
+
+public:
+    using value_type = T;
+
+    // Empty view (no elements).
+    Slice3DView();
+
+    // Full view over dim0 x dim1 x dim2 contiguous elements starting at data.
+    Slice3DView(const T* data, size_t dim0, size_t dim1, size_t dim2);
+
+    // Python-style [start0:stop0, start1:stop1, start2:stop2] on this view.
+    // Indices are relative to this view, with the same negative-index and
+    // clamping rules as slice_3d_optimized.
+    Slice3DView subview(int start0, int stop0,
+                        int start1, int stop1,
+                        int start2, int stop2) const;
+
+    // Stepped sub-view [start0:stop0:step0, ...] with NumPy semantics
+    // (negative steps, SLICE_NONE for omitted bounds). Still zero-copy: the
+    // steps are folded into the view's strides.
+    Slice3DView subview(int start0, int stop0, int step0,
+                        int start1, int stop1, int step1,
+                        int start2, int stop2, int step2) const;
+
+    // --- Shape / layout ---
+    size_t shape(size_t axis) const { return shape_[axis]; }
+    std::ptrdiff_t stride(size_t axis) const { return stride_[axis]; }
+    size_t size() const { return shape_[0] * shape_[1] * shape_[2]; }
+    bool empty() const { return size() == 0; }
+    const T* data() const { return origin_; }
+
+    // True when the viewed elements form one dense row-major block,
+    // i.e. materialize() would be a single memcpy.
+    bool is_contiguous() const;
+
+    // --- Element access ---
+    const T& operator()(size_t i, size_t j, size_t k) const {
+        return origin_[static_cast<std::ptrdiff_t>(i) * stride_[0] +
+                       static_cast<std::ptrdiff_t>(j) * stride_[1] +
+                       static_cast<std::ptrdiff_t>(k) * stride_[2]];
+    }
+
+    // Pointer to the first element of row (i, j). Consecutive elements of the
+    // row are stride(2) apart (1 unless a step was applied to axis 2).
+    const T* row(size_t i, size_t j) const {
+        return origin_ + static_cast<std::ptrdiff_t>(i) * stride_[0] +
+                         static_cast<std::ptrdiff_t>(j) * stride_[1];
+    }
+
+    // Calls fn(const T* run, size_t length) for each maximal contiguous run of
+    // the view in row-major order. Adjacent rows (and planes) are merged into a
+    // single run whenever the strides allow it, so a fully contiguous view
+    // produces exactly one call.
+    template <typename Fn>
+    void for_each_run(Fn&& fn) const;
+
+    // --- Copy out ---
+    // Writes size() elements to dst in row-major order. Rows with a non-unit
+    // stride go through the SIMD strided_copy kernels.
+    void materialize_into(T* dst) const;
+    std::vector<T> materialize() const;
+
+private:
+    Slice3DView(const T* origin, const size_t shape[3], const std::ptrdiff_t stride[3]);
+
+    const T* origin_;
+    size_t shape_[3];
+    std::ptrdiff_t stride_[3];
+};
+
+// Zero-copy counterpart of slice_3d_optimized: same arguments and validation,
+// but returns a view instead of a freshly allocated vector.
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, Slice3DView<T>>::type
+slice_3d_view(const std::vector<T>& data_1d,
+              size_t dim0, size_t dim1, size_t dim2,
+              int start0, int stop0,
+              int start1, int stop1,
+              int start2, int stop2);
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, Slice3DView<T>>::type
+slice_3d_view(const std::vector<T>& data_1d,
+              size_t dim0, size_t dim1, size_t dim2,
+              int start0, int stop0, int step0,
+              int start1, int stop1, int step1,
+              int start2, int stop2, int step2);
+
+// Include the implementation for templates
+#include "slice_3d_view.tpp"
+
+#endif // SLICE_3D_VIEW_H
@@ -0,0 +1,171 @@
+// src/slice_3d_view.tpp
+#ifndef SLICE_3D_VIEW_TPP
+#define SLICE_3D_VIEW_TPP
+
+#include "slice_3d_view.h"
+#include "strided_copy.h"
+#include <algorithm>
+#include <stdexcept>
+
+template <typename T>
+Slice3DView<T>::Slice3DView()
+    : origin_(nullptr), shape_{0, 0, 0}, stride_{0, 0, 1} {}
+
+template <typename T>
+Slice3DView<T>::Slice3DView(const T* data, size_t dim0, size_t dim1, size_t dim2)
+    : origin_(data),
+      shape_{dim0, dim1, dim2},
+      stride_{static_cast<std::ptrdiff_t>(dim1 * dim2), static_cast<std::ptrdiff_t>(dim2), 1} {}
+
+template <typename T>
+Slice3DView<T>::Slice3DView(const T* origin, const size_t shape[3], const std::ptrdiff_t stride[3])
+    : origin_(origin),
+      shape_{shape[0], shape[1], shape[2]},
+      stride_{stride[0], stride[1], stride[2]} {}
+
+template <typename T>
+Slice3DView<T> Slice3DView<T>::subview(int start0, int stop0,
+                                       int start1, int stop1,
+                                       int start2, int stop2) const {
+    return subview(start0, stop0, 1, start1, stop1, 1, start2, stop2, 1);
+}
+
+template <typename T>
+Slice3DView<T> Slice3DView<T>::subview(int start0, int stop0, int step0,
+                                       int start1, int stop1, int step1,
+                                       int start2, int stop2, int step2) const {
+    const SliceRange ranges[3] = {
+        normalize_slice(start0, stop0, step0, shape_[0]),
+        normalize_slice(start1, stop1, step1, shape_[1]),
+        normalize_slice(start2, stop2, step2, shape_[2]),
+    };
+
+    size_t new_shape[3];
+    std::ptrdiff_t new_stride[3];
+    bool is_empty = false;
+    for (size_t axis = 0; axis < 3; ++axis) {
+        new_shape[axis] = ranges[axis].length;
+        new_stride[axis] = stride_[axis] * ranges[axis].step;
+        is_empty = is_empty || new_shape[axis] == 0;
+    }
+
+    // Only move the origin for non-empty results so it never points past the
+    // viewed storage.
+    const T* new_origin = origin_;
+    if (!is_empty) {
+        for (size_t axis = 0; axis < 3; ++axis) {
+            new_origin += static_cast<std::ptrdiff_t>(ranges[axis].start) * stride_[axis];
+        }
+    }
+    return Slice3DView(new_origin, new_shape, new_stride);
+}
+
+template <typename T>
+bool Slice3DView<T>::is_contiguous() const {
+    // Axes of length 1 never advance, so their stride is irrelevant.
+    std::ptrdiff_t expected = 1;
+    for (size_t axis = 3; axis-- > 0;) {
+        if (shape_[axis] > 1 && stride_[axis] != expected) {
+            return false;
+        }
+        expected *= static_cast<std::ptrdiff_t>(shape_[axis]);
+    }
+    return true;
+}
+
+template <typename T>
+template <typename Fn>
+void Slice3DView<T>::for_each_run(Fn&& fn) const {
+    if (empty()) {
+        return;
+    }
+
+    // Innermost axis is not unit-stride: every element is its own run.
+    if (shape_[2] > 1 && stride_[2] != 1) {
+        for (size_t i = 0; i < shape_[0]; ++i) {
+            for (size_t j = 0; j < shape_[1]; ++j) {
+                const T* p = row(i, j);
+                for (size_t k = 0; k < shape_[2]; ++k, p += stride_[2]) {
+                    fn(p, size_t(1));
+                }
+            }
+        }
+        return;
+    }
+
+    // Rows are contiguous; try to merge the middle axis into them.
+    size_t run_len = shape_[2];
+    const bool merge1 = shape_[1] == 1 || stride_[1] == static_cast<std::ptrdiff_t>(shape_[2]);
+    if (!merge1) {
+        for (size_t i = 0; i < shape_[0]; ++i) {
+            for (size_t j = 0; j < shape_[1]; ++j) {
+                fn(row(i, j), run_len);
+            }
+        }
+        return;
+    }
+
+    // Each (i) plane is contiguous; try to merge the outer axis too.
+    run_len *= shape_[1];
+    const bool merge0 = shape_[0] == 1 || stride_[0] == static_cast<std::ptrdiff_t>(run_len);
+    if (merge0) {
+        fn(origin_, run_len * shape_[0]);
+        return;
+    }
+    for (size_t i = 0; i < shape_[0]; ++i) {
+        fn(row(i, 0), run_len);
+    }
+}
+
+template <typename T>
+void Slice3DView<T>::materialize_into(T* dst) const {
+    if (shape_[2] > 1 && stride_[2] != 1) {
+        for (size_t i = 0; i < shape_[0]; ++i) {
+            for (size_t j = 0; j < shape_[1]; ++j, dst += shape_[2]) {
+                strided_copy(row(i, j), stride_[2], shape_[2], dst);
+            }
+        }
+        return;
+    }
+    for_each_run([&dst](const T* run, size_t len) {
+        std::copy(run, run + len, dst);
+        dst += len;
+    });
+}
+
+template <typename T>
+std::vector<T> Slice3DView<T>::materialize() const {
+    std::vector<T> result_1d(size());
+    materialize_into(result_1d.data());
+    return result_1d;
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, Slice3DView<T>>::type
+slice_3d_view(const std::vector<T>& data_1d,
+              size_t dim0, size_t dim1, size_t dim2,
+              int start0, int stop0,
+              int start1, int stop1,
+              int start2, int stop2) {
+    if (data_1d.size() != dim0 * dim1 * dim2) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+    return Slice3DView<T>(data_1d.data(), dim0, dim1, dim2)
+        .subview(start0, stop0, start1, stop1, start2, stop2);
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, Slice3DView<T>>::type
+slice_3d_view(const std::vector<T>& data_1d,
+              size_t dim0, size_t dim1, size_t dim2,
+              int start0, int stop0, int step0,
+              int start1, int stop1, int step1,
+              int start2, int stop2, int step2) {
+    if (data_1d.size() != dim0 * dim1 * dim2) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+    return Slice3DView<T>(data_1d.data(), dim0, dim1, dim2)
+        .subview(start0, stop0, step0, start1, stop1, step1, start2, stop2, step2);
+}
+
+#endif // SLICE_3D_VIEW_TPP
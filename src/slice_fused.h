@@ -0,0 +1,78 @@
+// src/slice_fused.h
+#ifndef SLICE_FUSED_H
+#define SLICE_FUSED_H
+
+#include "slice_index.h"
+#include "slice_nd.h"
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+// Fused slice + element transform + axis permutation, producing the final
+// tensor in one pass instead of slicing first and converting afterwards.
+//
+// Output element (i0, i1, i2) is fn(s[j]) where s is the stepped slice and
+// j is (i0, i1, i2) scattered through axes, i.e. the result equals NumPy's
+// fn(data[...]).transpose(axes). With the identity permutation the slice is
+// walked as SliceNdPlan's coalesced runs; with any other permutation the two
+// axes that are fastest in the source and in the output are tiled so each
+// tile's reads and writes stay in L1.
+
+// x * scale + offset, evaluated in the output type.
+template <typename Out>
+struct AffineTransform {
+    Out scale = Out(1);
+    Out offset = Out(0);
+
+    template <typename In>
+    Out operator()(In x) const { return static_cast<Out>(x) * scale + offset; }
+};
+
+// Writes the transformed, permuted slice to dst (output size elements, no
+// allocation). Throws std::invalid_argument if axes is not a permutation of
+// {0, 1, 2}.
+template <typename Out, typename In, typename Fn>
+void slice_3d_transform_into(const In* src,
+                             size_t dim0, size_t dim1, size_t dim2,
+                             int start0, int stop0, int step0,
+                             int start1, int stop1, int step1,
+                             int start2, int stop2, int step2,
+                             Out* dst, Fn&& fn,
+                             const std::array<size_t, 3>& axes = {{0, 1, 2}});
+
+template <typename Out, typename In, typename Fn>
+typename std::enable_if<std::is_arithmetic<In>::value && std::is_arithmetic<Out>::value, std::vector<Out>>::type
+slice_3d_transform(const std::vector<In>& data_1d,
+                   size_t dim0, size_t dim1, size_t dim2,
+                   int start0, int stop0, int step0,
+                   int start1, int stop1, int step1,
+                   int start2, int stop2, int step2,
+                   Fn&& fn,
+                   const std::array<size_t, 3>& axes = {{0, 1, 2}});
+
+// static_cast<Out> of every element, e.g. int16 -> float.
+template <typename Out, typename In>
+typename std::enable_if<std::is_arithmetic<In>::value && std::is_arithmetic<Out>::value, std::vector<Out>>::type
+slice_3d_convert(const std::vector<In>& data_1d,
+                 size_t dim0, size_t dim1, size_t dim2,
+                 int start0, int stop0, int step0,
+                 int start1, int stop1, int step1,
+                 int start2, int stop2, int step2,
+                 const std::array<size_t, 3>& axes = {{0, 1, 2}});
+
+// static_cast<Out>(x) * scale + offset of every element.
+template <typename Out, typename In>
+typename std::enable_if<std::is_arithmetic<In>::value && std::is_arithmetic<Out>::value, std::vector<Out>>::type
+slice_3d_affine(const std::vector<In>& data_1d,
+                size_t dim0, size_t dim1, size_t dim2,
+                int start0, int stop0, int step0,
+                int start1, int stop1, int step1,
+                int start2, int stop2, int step2,
+                Out scale, Out offset,
+                const std::array<size_t, 3>& axes = {{0, 1, 2}});
+
+// Include the implementation for templates
+#include "slice_fused.tpp"
+
+#endif // SLICE_FUSED_H
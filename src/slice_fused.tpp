@@ -0,0 +1,168 @@
+// src/slice_fused.tpp
+#ifndef SLICE_FUSED_TPP
+#define SLICE_FUSED_TPP
+
+#include "slice_fused.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace slice_3d_detail {
+
+// Tile edge for permuted copies: 32 x 32 elements of up to 8 bytes is 8 KiB
+// of source plus 8 KiB of output, well inside L1.
+constexpr size_t FUSED_TILE = 32;
+
+} // namespace slice_3d_detail
+
+template <typename Out, typename In, typename Fn>
+void slice_3d_transform_into(const In* src,
+                             size_t dim0, size_t dim1, size_t dim2,
+                             int start0, int stop0, int step0,
+                             int start1, int stop1, int step1,
+                             int start2, int stop2, int step2,
+                             Out* dst, Fn&& fn,
+                             const std::array<size_t, 3>& axes) {
+    static_assert(std::is_arithmetic<In>::value && std::is_arithmetic<Out>::value,
+                  "slice_3d_transform_into requires arithmetic element types.");
+
+    bool seen[3] = {false, false, false};
+    for (size_t axis : axes) {
+        if (axis > 2 || seen[axis]) {
+            throw std::invalid_argument("axes must be a permutation of {0, 1, 2}.");
+        }
+        seen[axis] = true;
+    }
+
+    const SliceNdPlan<3> plan({dim0, dim1, dim2},
+                              {start0, start1, start2},
+                              {stop0, stop1, stop2},
+                              {step0, step1, step2});
+    if (plan.output_size() == 0) {
+        return;
+    }
+
+    // --- Identity permutation: coalesced runs, one fused loop per run ---
+    if (axes[0] == 0 && axes[1] == 1 && axes[2] == 2) {
+        plan.execute_range_with(src, dst, 0, plan.output_size(),
+                                [&fn](const In* first, std::ptrdiff_t step, size_t n, Out* out) {
+                                    if (step == 1) {
+                                        for (size_t i = 0; i < n; ++i) out[i] = fn(first[i]);
+                                    } else {
+                                        for (size_t i = 0; i < n; ++i, first += step) out[i] = fn(*first);
+                                    }
+                                });
+        return;
+    }
+
+    // --- Permuted: output axis i walks slice axis axes[i] ---
+    const std::ptrdiff_t in_stride[3] = {static_cast<std::ptrdiff_t>(dim1 * dim2),
+                                         static_cast<std::ptrdiff_t>(dim2), 1};
+    const In* origin = src;
+    size_t len[3];
+    std::ptrdiff_t stride[3];
+    for (size_t axis = 0; axis < 3; ++axis) {
+        origin += static_cast<std::ptrdiff_t>(plan.range(axis).start) * in_stride[axis];
+    }
+    for (size_t i = 0; i < 3; ++i) {
+        len[i] = plan.range(axes[i]).length;
+        stride[i] = plan.range(axes[i]).step * in_stride[axes[i]];
+    }
+    const size_t out_stride[3] = {len[1] * len[2], len[2], 1};
+
+    // k: the outer output axis that moves fastest through the source.
+    auto magnitude = [](std::ptrdiff_t s) { return s < 0 ? -s : s; };
+    const size_t k = magnitude(stride[0]) < magnitude(stride[1]) ? 0 : 1;
+    const size_t m = 1 - k;
+
+    // Source already fastest along the output's inner axis: plain row loops.
+    if (magnitude(stride[2]) <= magnitude(stride[k])) {
+        for (size_t a = 0; a < len[0]; ++a) {
+            for (size_t b = 0; b < len[1]; ++b) {
+                const In* first = origin + static_cast<std::ptrdiff_t>(a) * stride[0] +
+                                           static_cast<std::ptrdiff_t>(b) * stride[1];
+                Out* out = dst + a * out_stride[0] + b * out_stride[1];
+                for (size_t j = 0; j < len[2]; ++j, first += stride[2]) out[j] = fn(*first);
+            }
+        }
+        return;
+    }
+
+    // Tiled transpose of axes k and 2, for every index of axis m.
+    const size_t tile = slice_3d_detail::FUSED_TILE;
+    for (size_t om = 0; om < len[m]; ++om) {
+        const In* src_m = origin + static_cast<std::ptrdiff_t>(om) * stride[m];
+        Out* dst_m = dst + om * out_stride[m];
+        for (size_t k0 = 0; k0 < len[k]; k0 += tile) {
+            const size_t k1 = std::min(len[k], k0 + tile);
+            for (size_t j0 = 0; j0 < len[2]; j0 += tile) {
+                const size_t j1 = std::min(len[2], j0 + tile);
+                for (size_t ik = k0; ik < k1; ++ik) {
+                    const In* first = src_m + static_cast<std::ptrdiff_t>(ik) * stride[k] +
+                                              static_cast<std::ptrdiff_t>(j0) * stride[2];
+                    Out* out = dst_m + ik * out_stride[k];
+                    for (size_t j = j0; j < j1; ++j, first += stride[2]) out[j] = fn(*first);
+                }
+            }
+        }
+    }
+}
+
+template <typename Out, typename In, typename Fn>
+typename std::enable_if<std::is_arithmetic<In>::value && std::is_arithmetic<Out>::value, std::vector<Out>>::type
+slice_3d_transform(const std::vector<In>& data_1d,
+                   size_t dim0, size_t dim1, size_t dim2,
+                   int start0, int stop0, int step0,
+                   int start1, int stop1, int step1,
+                   int start2, int stop2, int step2,
+                   Fn&& fn,
+                   const std::array<size_t, 3>& axes) {
+    if (data_1d.size() != dim0 * dim1 * dim2) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+    const size_t result_size = normalize_slice(start0, stop0, step0, dim0).length *
+                               normalize_slice(start1, stop1, step1, dim1).length *
+                               normalize_slice(start2, stop2, step2, dim2).length;
+    std::vector<Out> result_1d(result_size);
+    slice_3d_transform_into<Out>(data_1d.data(), dim0, dim1, dim2,
+                                 start0, stop0, step0,
+                                 start1, stop1, step1,
+                                 start2, stop2, step2,
+                                 result_1d.data(), std::forward<Fn>(fn), axes);
+    return result_1d;
+}
+
+template <typename Out, typename In>
+typename std::enable_if<std::is_arithmetic<In>::value && std::is_arithmetic<Out>::value, std::vector<Out>>::type
+slice_3d_convert(const std::vector<In>& data_1d,
+                 size_t dim0, size_t dim1, size_t dim2,
+                 int start0, int stop0, int step0,
+                 int start1, int stop1, int step1,
+                 int start2, int stop2, int step2,
+                 const std::array<size_t, 3>& axes) {
+    return slice_3d_transform<Out>(data_1d, dim0, dim1, dim2,
+                                   start0, stop0, step0,
+                                   start1, stop1, step1,
+                                   start2, stop2, step2,
+                                   [](In x) { return static_cast<Out>(x); }, axes);
+}
+
+template <typename Out, typename In>
+typename std::enable_if<std::is_arithmetic<In>::value && std::is_arithmetic<Out>::value, std::vector<Out>>::type
+slice_3d_affine(const std::vector<In>& data_1d,
+                size_t dim0, size_t dim1, size_t dim2,
+                int start0, int stop0, int step0,
+                int start1, int stop1, int step1,
+                int start2, int stop2, int step2,
+                Out scale, Out offset,
+                const std::array<size_t, 3>& axes) {
+    AffineTransform<Out> affine;
+    affine.scale = scale;
+    affine.offset = offset;
+    return slice_3d_transform<Out>(data_1d, dim0, dim1, dim2,
+                                   start0, stop0, step0,
+                                   start1, stop1, step1,
+                                   start2, stop2, step2,
+                                   affine, axes);
+}
+
+#endif // SLICE_FUSED_TPP
@@ -0,0 +1,33 @@
+// src/slice_index.h
+#ifndef SLICE_INDEX_H
+#define SLICE_INDEX_H
+
+#include <cstddef>
+#include <type_traits>
+#include <limits>
+
+// Sentinel for an omitted slice bound, e.g. both bounds of "a[::-1]".
+// With a negative step there is no integer stop that means "through index 0".
+constexpr int SLICE_NONE = std::numeric_limits<int>::min();
+
+// One axis of a slice after applying Python's start:stop:step rules.
+// Element i of the slice is source index start + i * step, for i < length.
+struct SliceRange {
+    size_t start;
+    size_t length;
+    std::ptrdiff_t step;
+};
+
+// Template declarations
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, size_t>::type
+normalize_slice_index(T index, size_t dim_size);
+
+// Same result as Python's slice(start, stop, step).indices(dim_size).
+// Throws std::invalid_argument when step == 0.
+inline SliceRange normalize_slice(int start, int stop, int step, size_t dim_size);
+
+// Include the implementation for templates
+#include "slice_index.tpp"
+
+#endif // SLICE_INDEX_H
@@ -0,0 +1,68 @@
+// src/slice_index.tpp
+#ifndef SLICE_INDEX_TPP
+#define SLICE_INDEX_TPP
+
+#include "slice_index.h"
+#include <algorithm>
+#include <stdexcept>
+
+// --- Helper for index normalization ---
+// Handles ALL negative indices, including -1, according to Python rules.
+// -1 means the last element, -2 the second to last, etc.
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, size_t>::type
+normalize_slice_index(T index, size_t dim_size) {
+    if (index < 0) {
+        // In Python, negative indices are relative to the end.
+        // e.g., -1 is the last element, -2 is second to last.
+        // We clamp the result to be >= 0.
+        return static_cast<size_t>(std::max(static_cast<T>(0), static_cast<T>(dim_size) + index));
+    } else {
+        // Clamp positive indices to dim_size (Python allows index==dim_size for stop)
+        return static_cast<size_t>(std::min(static_cast<size_t>(index), dim_size));
+    }
+}
+
+// --- Full start:stop:step normalization ---
+// Mirrors CPython's PySlice_AdjustIndices. SLICE_NONE selects the default
+// bound for the step direction.
+inline SliceRange normalize_slice(int start, int stop, int step, size_t dim_size) {
+    if (step == 0) {
+        throw std::invalid_argument("Slice step cannot be zero.");
+    }
+    const long long len = static_cast<long long>(dim_size);
+    const bool backwards = step < 0;
+
+    auto adjust = [&](int index, long long omitted) -> long long {
+        if (index == SLICE_NONE) {
+            return omitted;
+        }
+        long long i = index;
+        if (i < 0) {
+            i += len;
+            if (i < 0) {
+                i = backwards ? -1 : 0;
+            }
+        } else if (i >= len) {
+            i = backwards ? len - 1 : len;
+        }
+        return i;
+    };
+    const long long first = adjust(start, backwards ? len - 1 : 0);
+    const long long last = adjust(stop, backwards ? -1 : len);
+
+    long long length = 0;
+    if (backwards && last < first) {
+        length = (first - last - 1) / (-static_cast<long long>(step)) + 1;
+    } else if (!backwards && first < last) {
+        length = (last - first - 1) / step + 1;
+    }
+
+    SliceRange range;
+    range.start = length > 0 ? static_cast<size_t>(first) : 0;
+    range.length = static_cast<size_t>(length);
+    range.step = step;
+    return range;
+}
+
+#endif // SLICE_INDEX_TPP
@@ -0,0 +1,123 @@
+// src/slice_io.h
+#ifndef SLICE_IO_H
+#define SLICE_IO_H
+
+#include "slice_3d.h"
+#include "slice_3d_view.h"
+#include "slice_nd.h"
+#include <vector>
+#include <array>
+#include <string>
+#include <iosfwd>
+#include <cstddef>
+#include <type_traits>
+
+// Binary I/O for flat arrays: raw native-endian dumps and NumPy .npy files
+// (format versions 1.0-3.0, C order only), plus read-only memory-mapped
+// access so a slice of a file-resident array only faults in the pages it
+// reads. All errors are reported as std::runtime_error.
+
+// --- Raw binary (no header, native byte order) ---
+template <typename T>
+void save_vector_to_binary(const std::vector<T>& vec, const std::string& filename);
+
+template <typename T>
+std::vector<T> load_vector_from_binary(const std::string& filename);
+
+// --- NumPy .npy ---
+// Parsed .npy header. data_offset is where the array bytes start.
+struct NpyHeader {
+    std::string descr;          // e.g. "<f4"
+    bool fortran_order = false;
+    std::vector<size_t> shape;  // empty for a 0-d array
+    size_t data_offset = 0;
+
+    // Element count; throws std::runtime_error if it does not fit in size_t.
+    size_t size() const;
+};
+
+// NumPy dtype string for T on this host, e.g. "<f4" for float, "<i4" for int.
+template <typename T>
+std::string npy_descr();
+
+inline NpyHeader read_npy_header(const std::string& filename);
+
+// Writes the magic, version and padded header dict; the caller appends
+// the C-order data. Lets large outputs be written to .npy incrementally.
+template <typename T>
+void write_npy_header(std::ostream& out, const std::vector<size_t>& shape);
+
+template <typename T>
+void save_npy(const std::vector<T>& vec, const std::vector<size_t>& shape, const std::string& filename);
+
+// Loads a C-order .npy whose dtype matches T exactly. The shape is returned
+// through shape_out when it is non-null.
+template <typename T>
+std::vector<T> load_npy(const std::string& filename, std::vector<size_t>* shape_out = nullptr);
+
+// --- Memory-mapped files ---
+// Read-only mapping of a whole file (POSIX mmap). Move-only.
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    void unmap();
+
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Typed array backed by a MappedFile. Nothing is read at open time beyond the
+// header; slicing through slice() or view_3d() touches only the pages holding
+// the selected elements.
+template <typename T>
+class MappedArray {
+    static_assert(std::is_arithmetic<T>::value, "MappedArray requires an arithmetic element type.");
+
+public:
+    MappedArray(MappedFile file, size_t data_offset, std::vector<size_t> shape);
+
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    const std::vector<size_t>& shape() const { return shape_; }
+
+    // data[starts:stops:steps] for an array of rank Rank (must match shape()).
+    template <size_t Rank>
+    std::vector<T> slice(const std::array<int, Rank>& starts,
+                         const std::array<int, Rank>& stops,
+                         const std::array<int, Rank>& steps) const;
+    template <size_t Rank>
+    std::vector<T> slice(const std::array<int, Rank>& starts,
+                         const std::array<int, Rank>& stops) const;
+
+    // Zero-copy view of a rank-3 array; valid while this object lives.
+    Slice3DView<T> view_3d() const;
+
+private:
+    MappedFile file_;
+    const T* data_;
+    size_t size_;
+    std::vector<size_t> shape_;
+};
+
+template <typename T>
+MappedArray<T> open_npy_mapped(const std::string& filename);
+
+template <typename T>
+MappedArray<T> open_binary_mapped(const std::string& filename, const std::vector<size_t>& shape);
+
+// Include the implementation for templates
+#include "slice_io.tpp"
+
+#endif // SLICE_IO_H
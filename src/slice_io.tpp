@@ -0,0 +1,432 @@
+// src/slice_io.tpp
+#ifndef SLICE_IO_TPP
+#define SLICE_IO_TPP
+
+#include "slice_io.h"
+#include <algorithm>
+#include <stdexcept>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdint>
+#include <climits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SLICE_3D_HAVE_MMAP 1
+#endif
+
+namespace slice_3d_detail {
+
+inline size_t file_size(std::ifstream& file, const std::string& filename) {
+    file.seekg(0, std::ios::end);
+    const std::streamoff end = file.tellg();
+    file.seekg(0, std::ios::beg);
+    if (end < 0) {
+        throw std::runtime_error("Could not determine size of file: " + filename);
+    }
+    return static_cast<size_t>(end);
+}
+
+inline void read_exact(std::istream& in, void* dst, size_t bytes, const std::string& filename) {
+    in.read(static_cast<char*>(dst), static_cast<std::streamsize>(bytes));
+    if (static_cast<size_t>(in.gcount()) != bytes) {
+        throw std::runtime_error("Unexpected end of file: " + filename);
+    }
+}
+
+// Product of shape, checked so that it times elem_size fits in size_t. Shapes
+// come from untrusted headers; a wrapped product would pass the file-size
+// checks and index far outside the data.
+inline size_t checked_element_count(const std::vector<size_t>& shape, size_t elem_size) {
+    if (std::find(shape.begin(), shape.end(), size_t(0)) != shape.end()) {
+        return 0;
+    }
+    const size_t limit = SIZE_MAX / elem_size;
+    size_t total = 1;
+    for (size_t d : shape) {
+        if (total > limit / d) {
+            throw std::runtime_error("Array shape is too large to address.");
+        }
+        total *= d;
+    }
+    return total;
+}
+
+inline bool host_is_little_endian() {
+    const uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+// Value of 'key' in the .npy header dict, up to the next top-level ',' or '}'.
+inline std::string npy_dict_value(const std::string& header, const std::string& key,
+                                  const std::string& filename) {
+    const size_t key_pos = header.find("'" + key + "'");
+    if (key_pos == std::string::npos) {
+        throw std::runtime_error("Missing '" + key + "' in .npy header: " + filename);
+    }
+    const size_t colon = header.find(':', key_pos);
+    if (colon == std::string::npos) {
+        throw std::runtime_error("Malformed .npy header: " + filename);
+    }
+    // The header is padded with spaces and ends in '\n'.
+    const size_t begin = header.find_first_not_of(" \n", colon + 1);
+    if (begin == std::string::npos) {
+        throw std::runtime_error("Malformed .npy header: " + filename);
+    }
+    size_t end = begin;
+    int depth = 0;
+    while (end < header.size()) {
+        const char c = header[end];
+        if (c == '(') ++depth;
+        if (c == ')') --depth;
+        if (depth == 0 && (c == ',' || c == '}')) break;
+        ++end;
+    }
+    std::string value = header.substr(begin, end - begin);
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\n')) value.pop_back();
+    return value;
+}
+
+} // namespace slice_3d_detail
+
+// --- Raw binary ---
+template <typename T>
+void save_vector_to_binary(const std::vector<T>& vec, const std::string& filename) {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file for writing: " + filename);
+    }
+    file.write(reinterpret_cast<const char*>(vec.data()), static_cast<std::streamsize>(vec.size() * sizeof(T)));
+    if (!file) {
+        throw std::runtime_error("Failed writing file: " + filename);
+    }
+}
+
+template <typename T>
+std::vector<T> load_vector_from_binary(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file for reading: " + filename);
+    }
+    const size_t bytes = slice_3d_detail::file_size(file, filename);
+    if (bytes % sizeof(T) != 0) {
+        throw std::runtime_error("File size is not a multiple of the element size: " + filename);
+    }
+    std::vector<T> vec(bytes / sizeof(T));
+    slice_3d_detail::read_exact(file, vec.data(), bytes, filename);
+    return vec;
+}
+
+// --- NumPy .npy ---
+inline size_t NpyHeader::size() const {
+    return slice_3d_detail::checked_element_count(shape, 1);
+}
+
+template <typename T>
+std::string npy_descr() {
+    static_assert(std::is_arithmetic<T>::value, "npy_descr requires an arithmetic element type.");
+    const char kind = std::is_same<T, bool>::value ? 'b'
+                    : std::is_floating_point<T>::value ? 'f'
+                    : std::is_signed<T>::value ? 'i' : 'u';
+    const char order = sizeof(T) == 1 ? '|' : (slice_3d_detail::host_is_little_endian() ? '<' : '>');
+    return std::string(1, order) + kind + std::to_string(sizeof(T));
+}
+
+inline NpyHeader read_npy_header(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file for reading: " + filename);
+    }
+
+    // Magic "\x93NUMPY", then major/minor version bytes.
+    unsigned char preamble[8];
+    slice_3d_detail::read_exact(file, preamble, sizeof(preamble), filename);
+    if (std::memcmp(preamble, "\x93NUMPY", 6) != 0) {
+        throw std::runtime_error("Not a .npy file: " + filename);
+    }
+    const unsigned major = preamble[6];
+    if (major < 1 || major > 3) {
+        throw std::runtime_error("Unsupported .npy version " + std::to_string(major) + ": " + filename);
+    }
+
+    // Header length: 2 bytes (v1) or 4 bytes (v2/v3), little-endian.
+    const size_t len_bytes = (major == 1) ? 2 : 4;
+    unsigned char len_buf[4] = {0, 0, 0, 0};
+    slice_3d_detail::read_exact(file, len_buf, len_bytes, filename);
+    size_t header_len = 0;
+    for (size_t i = len_bytes; i-- > 0;) header_len = (header_len << 8) | len_buf[i];
+
+    std::string header(header_len, '\0');
+    slice_3d_detail::read_exact(file, &header[0], header_len, filename);
+
+    NpyHeader result;
+    result.data_offset = sizeof(preamble) + len_bytes + header_len;
+
+    std::string descr = slice_3d_detail::npy_dict_value(header, "descr", filename);
+    if (descr.size() < 2 || (descr.front() != '\'' && descr.front() != '"')) {
+        throw std::runtime_error("Unsupported .npy dtype " + descr + ": " + filename);
+    }
+    result.descr = descr.substr(1, descr.size() - 2);
+
+    result.fortran_order = slice_3d_detail::npy_dict_value(header, "fortran_order", filename) == "True";
+
+    // A Python tuple of non-negative integers: "()", "(3,)", "(2, 3, 4)".
+    const std::string shape = slice_3d_detail::npy_dict_value(header, "shape", filename);
+    const std::string bad_shape = "Malformed .npy shape " + shape + ": " + filename;
+    if (shape.size() < 2 || shape.front() != '(' || shape.back() != ')') {
+        throw std::runtime_error(bad_shape);
+    }
+    const std::string items = shape.substr(1, shape.size() - 2);
+    size_t pos = 0;
+    while (items.find_first_not_of(' ', pos) != std::string::npos) {
+        const size_t comma = std::min(items.find(',', pos), items.size());
+        const size_t first = items.find_first_not_of(' ', pos);
+        const size_t last = items.find_last_not_of(' ', comma - 1);
+        if (first >= comma || last == std::string::npos || last < first) {
+            throw std::runtime_error(bad_shape);
+        }
+        const std::string digits = items.substr(first, last - first + 1);
+        if (digits.find_first_not_of("0123456789") != std::string::npos) {
+            throw std::runtime_error(bad_shape);
+        }
+        unsigned long long d = 0;
+        try {
+            d = std::stoull(digits);
+        } catch (const std::out_of_range&) {
+            d = ULLONG_MAX;
+        }
+        if (d > SIZE_MAX) {
+            throw std::runtime_error(bad_shape);
+        }
+        result.shape.push_back(static_cast<size_t>(d));
+        pos = comma + 1;
+    }
+    // Reject shapes whose element count would wrap.
+    result.size();
+    return result;
+}
+
+template <typename T>
+void write_npy_header(std::ostream& out, const std::vector<size_t>& shape) {
+    std::ostringstream dict;
+    dict << "{'descr': '" << npy_descr<T>() << "', 'fortran_order': False, 'shape': (";
+    for (size_t i = 0; i < shape.size(); ++i) {
+        dict << shape[i] << ((shape.size() == 1 || i + 1 < shape.size()) ? "," : "");
+        if (i + 1 < shape.size()) dict << " ";
+    }
+    dict << "), }";
+    std::string header = dict.str();
+
+    // Pad with spaces and a final '\n' so the data starts 64-byte aligned.
+    // Version 1.0 stores the header length in 2 bytes; fall back to 2.0.
+    auto padded_len = [&header](size_t preamble) {
+        return ((preamble + header.size() + 1 + 63) / 64) * 64 - preamble;
+    };
+    const bool v1 = padded_len(10) <= 65535;
+    const size_t target = padded_len(v1 ? 10 : 12);
+    header.append(target - header.size() - 1, ' ');
+    header += '\n';
+
+    out.write("\x93NUMPY", 6);
+    const size_t header_len = header.size();
+    if (v1) {
+        const char version[2] = {1, 0};
+        const unsigned char len[2] = {static_cast<unsigned char>(header_len & 0xff),
+                                      static_cast<unsigned char>((header_len >> 8) & 0xff)};
+        out.write(version, 2);
+        out.write(reinterpret_cast<const char*>(len), 2);
+    } else {
+        const char version[2] = {2, 0};
+        unsigned char len[4];
+        for (size_t i = 0; i < 4; ++i) len[i] = static_cast<unsigned char>((header_len >> (8 * i)) & 0xff);
+        out.write(version, 2);
+        out.write(reinterpret_cast<const char*>(len), 4);
+    }
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+template <typename T>
+void save_npy(const std::vector<T>& vec, const std::vector<size_t>& shape, const std::string& filename) {
+    size_t total = 1;
+    for (size_t d : shape) total *= d;
+    if (total != vec.size()) {
+        throw std::runtime_error("Shape does not match data size for: " + filename);
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file for writing: " + filename);
+    }
+    write_npy_header<T>(file, shape);
+    file.write(reinterpret_cast<const char*>(vec.data()), static_cast<std::streamsize>(vec.size() * sizeof(T)));
+    if (!file) {
+        throw std::runtime_error("Failed writing file: " + filename);
+    }
+}
+
+namespace slice_3d_detail {
+
+template <typename T>
+void check_npy_header(const NpyHeader& header, const std::string& filename) {
+    if (header.descr != npy_descr<T>()) {
+        throw std::runtime_error("dtype mismatch: file has '" + header.descr + "', expected '" +
+                                 npy_descr<T>() + "': " + filename);
+    }
+    if (header.fortran_order && header.shape.size() > 1) {
+        throw std::runtime_error("Fortran-order .npy files are not supported: " + filename);
+    }
+}
+
+} // namespace slice_3d_detail
+
+template <typename T>
+std::vector<T> load_npy(const std::string& filename, std::vector<size_t>* shape_out) {
+    const NpyHeader header = read_npy_header(filename);
+    slice_3d_detail::check_npy_header<T>(header, filename);
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file for reading: " + filename);
+    }
+    // Check the data fits in the file before allocating for it.
+    const size_t count = slice_3d_detail::checked_element_count(header.shape, sizeof(T));
+    const size_t bytes = slice_3d_detail::file_size(file, filename);
+    if (header.data_offset > bytes || (bytes - header.data_offset) / sizeof(T) < count) {
+        throw std::runtime_error(".npy file is smaller than the array it should hold: " + filename);
+    }
+    file.seekg(static_cast<std::streamoff>(header.data_offset));
+    std::vector<T> vec(count);
+    slice_3d_detail::read_exact(file, vec.data(), vec.size() * sizeof(T), filename);
+    if (shape_out) {
+        *shape_out = header.shape;
+    }
+    return vec;
+}
+
+// --- Memory-mapped files ---
+inline MappedFile::MappedFile(const std::string& filename) {
+#ifdef SLICE_3D_HAVE_MMAP
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file for reading: " + filename);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Could not stat file: " + filename);
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+        void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Could not map file: " + filename);
+        }
+        data_ = static_cast<const unsigned char*>(p);
+    }
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+#else
+    throw std::runtime_error("Memory-mapped files are not supported on this platform: " + filename);
+#endif
+}
+
+inline MappedFile::~MappedFile() {
+    unmap();
+}
+
+inline MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_), size_(other.size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+inline MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        data_ = other.data_;
+        size_ = other.size_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+inline void MappedFile::unmap() {
+#ifdef SLICE_3D_HAVE_MMAP
+    if (data_) {
+        ::munmap(const_cast<unsigned char*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+template <typename T>
+MappedArray<T>::MappedArray(MappedFile file, size_t data_offset, std::vector<size_t> shape)
+    : file_(std::move(file)), data_(nullptr),
+      size_(slice_3d_detail::checked_element_count(shape, sizeof(T))), shape_(std::move(shape)) {
+    if (data_offset > file_.size() || (file_.size() - data_offset) / sizeof(T) < size_) {
+        throw std::runtime_error("Mapped file is smaller than the array it should hold.");
+    }
+    if (data_offset % alignof(T) != 0) {
+        throw std::runtime_error("Mapped array data is not aligned for its element type.");
+    }
+    if (file_.data()) {
+        data_ = reinterpret_cast<const T*>(file_.data() + data_offset);
+    }
+}
+
+template <typename T>
+template <size_t Rank>
+std::vector<T> MappedArray<T>::slice(const std::array<int, Rank>& starts,
+                                     const std::array<int, Rank>& stops,
+                                     const std::array<int, Rank>& steps) const {
+    if (shape_.size() != Rank) {
+        throw std::invalid_argument("Slice rank does not match mapped array rank.");
+    }
+    std::array<size_t, Rank> dims;
+    std::copy(shape_.begin(), shape_.end(), dims.begin());
+    const SliceNdPlan<Rank> plan(dims, starts, stops, steps);
+    std::vector<T> result_1d(plan.output_size());
+    plan.execute(data_, result_1d.data());
+    return result_1d;
+}
+
+template <typename T>
+template <size_t Rank>
+std::vector<T> MappedArray<T>::slice(const std::array<int, Rank>& starts,
+                                     const std::array<int, Rank>& stops) const {
+    std::array<int, Rank> steps;
+    steps.fill(1);
+    return slice<Rank>(starts, stops, steps);
+}
+
+template <typename T>
+Slice3DView<T> MappedArray<T>::view_3d() const {
+    if (shape_.size() != 3) {
+        throw std::invalid_argument("view_3d requires a rank-3 mapped array.");
+    }
+    return Slice3DView<T>(data_, shape_[0], shape_[1], shape_[2]);
+}
+
+template <typename T>
+MappedArray<T> open_npy_mapped(const std::string& filename) {
+    const NpyHeader header = read_npy_header(filename);
+    slice_3d_detail::check_npy_header<T>(header, filename);
+    return MappedArray<T>(MappedFile(filename), header.data_offset, header.shape);
+}
+
+template <typename T>
+MappedArray<T> open_binary_mapped(const std::string& filename, const std::vector<size_t>& shape) {
+    return MappedArray<T>(MappedFile(filename), 0, shape);
+}
+
+#endif // SLICE_IO_TPP
@@ -0,0 +1,108 @@
+// src/slice_nd.h
+#ifndef SLICE_ND_H
+#define SLICE_ND_H
+
+#include "slice_index.h"
+#include "slice_stats.h"
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+// Slice of a row-major array with compile-time rank, reduced to the smallest
+// loop nest that copies it.
+//
+// Construction normalizes every axis (Python start:stop:step rules) and then
+// coalesces axes: length-1 axes are dropped, and an axis is merged into the
+// next inner one whenever its source stride equals the inner axis' length
+// times stride. Whatever remains innermost is the "run" (one std::copy, or one
+// strided_copy for non-unit steps); the rest is an odometer over runs. For
+// example data[a:b, c:d, :] becomes one run of (d - c) * dim2 elements per
+// dim0 index, and any slice that is a single dense block becomes one copy.
+template <size_t Rank>
+class SliceNdPlan {
+    static_assert(Rank >= 1, "SliceNdPlan requires Rank >= 1.");
+
+public:
+    using Shape = std::array<size_t, Rank>;
+    using Index = std::array<int, Rank>;
+
+    SliceNdPlan(const Shape& dims, const Index& starts, const Index& stops);
+    SliceNdPlan(const Shape& dims, const Index& starts, const Index& stops, const Index& steps);
+
+    const Shape& input_shape() const { return dims_; }
+    const Shape& output_shape() const { return out_shape_; }
+    const SliceRange& range(size_t axis) const { return ranges_[axis]; }
+    size_t input_size() const;
+    size_t output_size() const;
+
+    // --- Coalesced loop nest ---
+    // Elements per run and their source stride (1 means a plain copy).
+    size_t run_length() const { return run_len_; }
+    std::ptrdiff_t run_step() const { return run_step_; }
+    // Number of runs, and how many coalesced axes the odometer walks.
+    size_t run_count() const;
+    size_t loop_rank() const { return loop_rank_; }
+    // True when the whole slice is one dense block of the source.
+    bool is_contiguous() const { return run_step_ == 1 && run_count() <= 1; }
+    // Pattern label for reporting: FirstDim / LastDim when every axis but
+    // the first / last is taken whole, MiddleDim for any other single axis.
+    SlicePath path() const;
+
+    // Unchecked: src must hold input_size() elements, dst output_size().
+    // Counted in the slice stats when SLICE_3D_STATS is defined.
+    template <typename T>
+    void execute(const T* src, T* dst) const;
+
+    // Writes output elements [out_begin, out_end) to dst + out_begin. Ranges
+    // may start or end in the middle of a run, so callers can split the
+    // output at any element (e.g. one range per thread).
+    template <typename T>
+    void execute_range(const T* src, T* dst, size_t out_begin, size_t out_end) const;
+
+    // Same traversal, but each (partial) run is handed to
+    // run(In* first, std::ptrdiff_t step, size_t n, Out* dense) instead of
+    // being copied, so callers can fuse a conversion into the single pass.
+    // In may be non-const, which lets the same traversal write into the
+    // sliced region (scatter) with dense as the source.
+    template <typename In, typename Out, typename RunFn>
+    void execute_range_with(In* src, Out* dst, size_t out_begin, size_t out_end, RunFn&& run) const;
+
+private:
+    void build(const Index& starts, const Index& stops, const Index& steps);
+
+    Shape dims_;
+    Shape out_shape_;
+    std::array<SliceRange, Rank> ranges_;
+
+    // Source offset of the first output element.
+    std::ptrdiff_t origin_;
+    size_t run_len_;
+    std::ptrdiff_t run_step_;
+    // Coalesced outer axes, outermost first: lengths and source strides.
+    size_t loop_rank_;
+    std::array<size_t, Rank> loop_len_;
+    std::array<std::ptrdiff_t, Rank> loop_stride_;
+};
+
+// data[start0:stop0, ..., startN:stopN] for a row-major array of shape dims.
+template <typename T, size_t Rank>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_nd(const std::vector<T>& data_1d,
+         const std::array<size_t, Rank>& dims,
+         const std::array<int, Rank>& starts,
+         const std::array<int, Rank>& stops);
+
+// Stepped variant with NumPy semantics (negative steps, SLICE_NONE bounds).
+template <typename T, size_t Rank>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_nd(const std::vector<T>& data_1d,
+         const std::array<size_t, Rank>& dims,
+         const std::array<int, Rank>& starts,
+         const std::array<int, Rank>& stops,
+         const std::array<int, Rank>& steps);
+
+// Include the implementation for templates
+#include "slice_nd.tpp"
+
+#endif // SLICE_ND_H
@@ -0,0 +1,231 @@
+// src/slice_nd.tpp
+#ifndef SLICE_ND_TPP
+#define SLICE_ND_TPP
+
+#include "slice_nd.h"
+#include "strided_copy.h"
+#include <algorithm>
+#include <stdexcept>
+
+template <size_t Rank>
+SliceNdPlan<Rank>::SliceNdPlan(const Shape& dims, const Index& starts, const Index& stops)
+    : dims_(dims) {
+    Index steps;
+    steps.fill(1);
+    build(starts, stops, steps);
+}
+
+template <size_t Rank>
+SliceNdPlan<Rank>::SliceNdPlan(const Shape& dims, const Index& starts, const Index& stops, const Index& steps)
+    : dims_(dims) {
+    build(starts, stops, steps);
+}
+
+template <size_t Rank>
+void SliceNdPlan<Rank>::build(const Index& starts, const Index& stops, const Index& steps) {
+    // --- Normalize every axis and compute source strides (Row-Major Order) ---
+    std::array<std::ptrdiff_t, Rank> src_stride;
+    std::ptrdiff_t stride = 1;
+    for (size_t axis = Rank; axis-- > 0;) {
+        src_stride[axis] = stride;
+        stride *= static_cast<std::ptrdiff_t>(dims_[axis]);
+    }
+
+    bool is_empty = false;
+    origin_ = 0;
+    for (size_t axis = 0; axis < Rank; ++axis) {
+        ranges_[axis] = normalize_slice(starts[axis], stops[axis], steps[axis], dims_[axis]);
+        out_shape_[axis] = ranges_[axis].length;
+        origin_ += static_cast<std::ptrdiff_t>(ranges_[axis].start) * src_stride[axis];
+        is_empty = is_empty || ranges_[axis].length == 0;
+    }
+
+    run_len_ = 1;
+    run_step_ = 1;
+    loop_rank_ = 0;
+    if (is_empty) {
+        origin_ = 0;
+        run_len_ = 0;
+        return;
+    }
+
+    // --- Coalesce, innermost axis first ---
+    // (len, stride) of each kept axis as seen in the source; the output is
+    // always dense, so an outer axis merges with the inner one exactly when
+    // its stride equals inner length * inner stride.
+    bool have_run = false;
+    std::array<size_t, Rank> len_inner_first;
+    std::array<std::ptrdiff_t, Rank> stride_inner_first;
+    size_t loops = 0;
+    for (size_t axis = Rank; axis-- > 0;) {
+        const size_t len = ranges_[axis].length;
+        if (len == 1) {
+            continue;
+        }
+        const std::ptrdiff_t s = ranges_[axis].step * src_stride[axis];
+        if (!have_run) {
+            run_len_ = len;
+            run_step_ = s;
+            have_run = true;
+        } else if (loops == 0 && s == static_cast<std::ptrdiff_t>(run_len_) * run_step_) {
+            run_len_ *= len;
+        } else if (loops > 0 && s == static_cast<std::ptrdiff_t>(len_inner_first[loops - 1]) * stride_inner_first[loops - 1]) {
+            len_inner_first[loops - 1] *= len;
+        } else {
+            len_inner_first[loops] = len;
+            stride_inner_first[loops] = s;
+            ++loops;
+        }
+    }
+
+    loop_rank_ = loops;
+    for (size_t d = 0; d < loops; ++d) {
+        loop_len_[d] = len_inner_first[loops - 1 - d];
+        loop_stride_[d] = stride_inner_first[loops - 1 - d];
+    }
+}
+
+template <size_t Rank>
+size_t SliceNdPlan<Rank>::input_size() const {
+    size_t size = 1;
+    for (size_t axis = 0; axis < Rank; ++axis) size *= dims_[axis];
+    return size;
+}
+
+template <size_t Rank>
+size_t SliceNdPlan<Rank>::output_size() const {
+    size_t size = 1;
+    for (size_t axis = 0; axis < Rank; ++axis) size *= out_shape_[axis];
+    return size;
+}
+
+template <size_t Rank>
+size_t SliceNdPlan<Rank>::run_count() const {
+    if (run_len_ == 0) {
+        return 0;
+    }
+    size_t count = 1;
+    for (size_t d = 0; d < loop_rank_; ++d) count *= loop_len_[d];
+    return count;
+}
+
+template <size_t Rank>
+SlicePath SliceNdPlan<Rank>::path() const {
+    if (run_len_ == 0) {
+        return SlicePath::Empty;
+    }
+    // With unit steps, full extent on an axis implies start == 0 on it.
+    size_t partial_axes = 0;
+    size_t partial_axis = 0;
+    for (size_t axis = 0; axis < Rank; ++axis) {
+        if (ranges_[axis].step != 1) {
+            return SlicePath::Strided;
+        }
+        if (ranges_[axis].length != dims_[axis]) {
+            ++partial_axes;
+            partial_axis = axis;
+        }
+    }
+
+    if (partial_axes > 1) {
+        return SlicePath::General;
+    } else if (partial_axis == 0) {
+        return SlicePath::FirstDim;
+    } else if (partial_axis == Rank - 1) {
+        return SlicePath::LastDim;
+    }
+    return SlicePath::MiddleDim;
+}
+
+template <size_t Rank>
+template <typename T>
+void SliceNdPlan<Rank>::execute(const T* src, T* dst) const {
+    SLICE_3D_STATS_SCOPE(path(), sizeof(T), output_size(), run_len_, run_count(), run_step_ != 1);
+    execute_range(src, dst, 0, output_size());
+}
+
+template <size_t Rank>
+template <typename T>
+void SliceNdPlan<Rank>::execute_range(const T* src, T* dst, size_t out_begin, size_t out_end) const {
+    static_assert(std::is_arithmetic<T>::value, "SliceNdPlan requires an arithmetic element type.");
+    execute_range_with(src, dst, out_begin, out_end,
+                       [](const T* first, std::ptrdiff_t step, size_t n, T* out) {
+                           if (step == 1) {
+                               std::copy(first, first + n, out);
+                           } else {
+                               strided_copy(first, step, n, out);
+                           }
+                       });
+}
+
+template <size_t Rank>
+template <typename In, typename Out, typename RunFn>
+void SliceNdPlan<Rank>::execute_range_with(In* src, Out* dst, size_t out_begin, size_t out_end,
+                                           RunFn&& run) const {
+    if (out_begin >= out_end) {
+        return;
+    }
+
+    // Position the odometer on the run containing out_begin.
+    size_t run_index = out_begin / run_len_;
+    size_t offset = out_begin % run_len_;
+    std::array<size_t, Rank> index{};
+    std::ptrdiff_t pos = origin_;
+    for (size_t d = loop_rank_; d-- > 0;) {
+        index[d] = run_index % loop_len_[d];
+        run_index /= loop_len_[d];
+        pos += static_cast<std::ptrdiff_t>(index[d]) * loop_stride_[d];
+    }
+
+    dst += out_begin;
+    size_t remaining = out_end - out_begin;
+    while (true) {
+        const size_t n = std::min(run_len_ - offset, remaining);
+        run(src + pos + static_cast<std::ptrdiff_t>(offset) * run_step_, run_step_, n, dst);
+        dst += n;
+        remaining -= n;
+        if (remaining == 0) {
+            return;
+        }
+        offset = 0;
+
+        // Advance to the next run.
+        for (size_t d = loop_rank_; d-- > 0;) {
+            pos += loop_stride_[d];
+            if (++index[d] < loop_len_[d]) {
+                break;
+            }
+            pos -= static_cast<std::ptrdiff_t>(loop_len_[d]) * loop_stride_[d];
+            index[d] = 0;
+        }
+    }
+}
+
+template <typename T, size_t Rank>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_nd(const std::vector<T>& data_1d,
+         const std::array<size_t, Rank>& dims,
+         const std::array<int, Rank>& starts,
+         const std::array<int, Rank>& stops) {
+    std::array<int, Rank> steps;
+    steps.fill(1);
+    return slice_nd<T, Rank>(data_1d, dims, starts, stops, steps);
+}
+
+template <typename T, size_t Rank>
+typename std::enable_if<std::is_arithmetic<T>::value, std::vector<T>>::type
+slice_nd(const std::vector<T>& data_1d,
+         const std::array<size_t, Rank>& dims,
+         const std::array<int, Rank>& starts,
+         const std::array<int, Rank>& stops,
+         const std::array<int, Rank>& steps) {
+    const SliceNdPlan<Rank> plan(dims, starts, stops, steps);
+    if (data_1d.size() != plan.input_size()) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+    std::vector<T> result_1d(plan.output_size());
+    plan.execute(data_1d.data(), result_1d.data());
+    return result_1d;
+}
+
+#endif // SLICE_ND_TPP
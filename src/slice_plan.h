@@ -0,0 +1,105 @@
+// src/slice_plan.h
+#ifndef SLICE_PLAN_H
+#define SLICE_PLAN_H
+
+#include "slice_3d.h"
+#include "slice_nd.h"
+#include "slice_stats.h"
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+
+// Parallel execution policy. The output is split into contiguous element
+// ranges, one per thread, so every thread writes a disjoint part of it and the
+// result is bit-identical to the serial path.
+struct ParallelPolicy {
+    // Worker count; 0 means std::thread::hardware_concurrency().
+    size_t num_threads = 0;
+    // Outputs smaller than this stay serial: below a few MiB thread start-up
+    // costs more than the copy. Also the minimum share of each thread.
+    size_t min_parallel_bytes = size_t(4) << 20;
+};
+
+// Precomputed slice for repeated use on tensors of identical shape.
+// Construction does all the per-call work of slice_3d_optimized once
+// (index normalization, output shape, axis coalescing via SliceNdPlan<3>);
+// execute() then only copies, writing into a caller-supplied buffer without
+// any heap allocation. A plan holds no data pointers and may be shared across
+// threads.
+class SlicePlan {
+public:
+    // Slice pattern (see SlicePath in slice_stats.h). Execution is the same
+    // coalesced loop nest for all of them; the pattern is kept for callers
+    // that report or route on it.
+    using Kernel = SlicePath;
+
+    SlicePlan(size_t dim0, size_t dim1, size_t dim2,
+              int start0, int stop0,
+              int start1, int stop1,
+              int start2, int stop2);
+
+    // Stepped plan with NumPy semantics (see slice_3d_optimized).
+    SlicePlan(size_t dim0, size_t dim1, size_t dim2,
+              int start0, int stop0, int step0,
+              int start1, int stop1, int step1,
+              int start2, int stop2, int step2);
+
+    size_t input_dim(size_t axis) const { return nd_.input_shape()[axis]; }
+    size_t start(size_t axis) const { return nd_.range(axis).start; }
+    size_t shape(size_t axis) const { return nd_.range(axis).length; }
+    std::ptrdiff_t step(size_t axis) const { return nd_.range(axis).step; }
+    size_t input_size() const { return nd_.input_size(); }
+    size_t output_size() const { return nd_.output_size(); }
+    Kernel kernel() const { return kernel_; }
+    const SliceNdPlan<3>& nd_plan() const { return nd_; }
+
+    // Unchecked: src must hold input_size() elements, dst output_size().
+    template <typename T>
+    void execute(const T* src, T* dst) const;
+
+    // Checked, for any caller-owned buffer (arena, pool, mapped file, ...):
+    // throws std::invalid_argument unless src_size == input_size() and
+    // dst_size >= output_size(). Never allocates.
+    template <typename T>
+    void execute(const T* src, size_t src_size, T* dst, size_t dst_size) const;
+
+    // Checked convenience: validates src size and resizes dst to
+    // output_size(). Reusing the same dst across calls keeps its capacity, so
+    // steady state does not allocate.
+    template <typename T>
+    void execute(const std::vector<T>& src, std::vector<T>& dst) const;
+
+    // Parallel variants of the above; they fall back to the serial path when
+    // the output is below policy.min_parallel_bytes.
+    template <typename T>
+    void execute(const T* src, T* dst, const ParallelPolicy& policy) const;
+    template <typename T>
+    void execute(const T* src, size_t src_size, T* dst, size_t dst_size, const ParallelPolicy& policy) const;
+    template <typename T>
+    void execute(const std::vector<T>& src, std::vector<T>& dst, const ParallelPolicy& policy) const;
+
+    // Applies the plan to count inputs stored back-to-back in src (each
+    // input_size() long), writing count outputs back-to-back into dst (each
+    // output_size() long).
+    template <typename T>
+    void execute_batch(const T* src, T* dst, size_t count) const;
+
+    // Same, for inputs and outputs in separate buffers.
+    template <typename T>
+    void execute_batch(const T* const* srcs, T* const* dsts, size_t count) const;
+
+    // Number of threads execute(src, dst, policy) would use for element type T.
+    template <typename T>
+    size_t parallel_threads(const ParallelPolicy& policy) const;
+
+private:
+    void check_buffers(size_t src_size, size_t dst_size) const;
+
+    SliceNdPlan<3> nd_;
+    Kernel kernel_;
+};
+
+// Include the implementation for templates
+#include "slice_plan.tpp"
+
+#endif // SLICE_PLAN_H
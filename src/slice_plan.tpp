@@ -0,0 +1,133 @@
+// src/slice_plan.tpp
+#ifndef SLICE_PLAN_TPP
+#define SLICE_PLAN_TPP
+
+#include "slice_plan.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+inline SlicePlan::SlicePlan(size_t dim0, size_t dim1, size_t dim2,
+                            int start0, int stop0,
+                            int start1, int stop1,
+                            int start2, int stop2)
+    : SlicePlan(dim0, dim1, dim2, start0, stop0, 1, start1, stop1, 1, start2, stop2, 1) {}
+
+inline SlicePlan::SlicePlan(size_t dim0, size_t dim1, size_t dim2,
+                            int start0, int stop0, int step0,
+                            int start1, int stop1, int step1,
+                            int start2, int stop2, int step2)
+    : nd_({dim0, dim1, dim2},
+          {start0, start1, start2},
+          {stop0, stop1, stop2},
+          {step0, step1, step2}),
+      kernel_(nd_.path()) {}
+
+template <typename T>
+void SlicePlan::execute(const T* src, T* dst) const {
+    nd_.execute(src, dst);
+}
+
+inline void SlicePlan::check_buffers(size_t src_size, size_t dst_size) const {
+    if (src_size != input_size()) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+    if (dst_size < output_size()) {
+        throw std::invalid_argument("Output buffer is smaller than the slice.");
+    }
+}
+
+template <typename T>
+void SlicePlan::execute(const T* src, size_t src_size, T* dst, size_t dst_size) const {
+    check_buffers(src_size, dst_size);
+    execute(src, dst);
+}
+
+template <typename T>
+void SlicePlan::execute(const std::vector<T>& src, std::vector<T>& dst) const {
+    if (src.size() != input_size()) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+    dst.resize(output_size());
+    execute(src.data(), dst.data());
+}
+
+template <typename T>
+size_t SlicePlan::parallel_threads(const ParallelPolicy& policy) const {
+    const size_t bytes = output_size() * sizeof(T);
+    if (kernel_ == Kernel::Empty || bytes < policy.min_parallel_bytes) {
+        return 1;
+    }
+    size_t threads = policy.num_threads;
+    if (threads == 0) {
+        threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    // Each thread gets at least min_parallel_bytes and at least one element.
+    if (policy.min_parallel_bytes > 0) {
+        threads = std::min(threads, bytes / policy.min_parallel_bytes);
+    }
+    threads = std::min(threads, output_size());
+    return std::max<size_t>(1, threads);
+}
+
+template <typename T>
+void SlicePlan::execute(const T* src, T* dst, const ParallelPolicy& policy) const {
+    const size_t threads = parallel_threads<T>(policy);
+    if (threads <= 1) {
+        execute(src, dst);
+        return;
+    }
+
+    SLICE_3D_STATS_SCOPE(kernel_, sizeof(T), output_size(), nd_.run_length(), nd_.run_count(),
+                         nd_.run_step() != 1);
+    // Contiguous, near-equal output ranges; the calling thread takes the
+    // first. Ranges may split a run, which execute_range handles.
+    const size_t total = output_size();
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    try {
+        for (size_t t = 1; t < threads; ++t) {
+            workers.emplace_back([this, src, dst, total, threads, t]() {
+                nd_.execute_range(src, dst, total * t / threads, total * (t + 1) / threads);
+            });
+        }
+    } catch (...) {
+        for (auto& w : workers) w.join();
+        throw;
+    }
+    nd_.execute_range(src, dst, 0, total / threads);
+    for (auto& w : workers) w.join();
+}
+
+template <typename T>
+void SlicePlan::execute(const T* src, size_t src_size, T* dst, size_t dst_size, const ParallelPolicy& policy) const {
+    check_buffers(src_size, dst_size);
+    execute(src, dst, policy);
+}
+
+template <typename T>
+void SlicePlan::execute(const std::vector<T>& src, std::vector<T>& dst, const ParallelPolicy& policy) const {
+    if (src.size() != input_size()) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+    dst.resize(output_size());
+    execute(src.data(), dst.data(), policy);
+}
+
+template <typename T>
+void SlicePlan::execute_batch(const T* src, T* dst, size_t count) const {
+    const size_t in_size = input_size();
+    const size_t out_size = output_size();
+    for (size_t b = 0; b < count; ++b) {
+        execute(src + b * in_size, dst + b * out_size);
+    }
+}
+
+template <typename T>
+void SlicePlan::execute_batch(const T* const* srcs, T* const* dsts, size_t count) const {
+    for (size_t b = 0; b < count; ++b) {
+        execute(srcs[b], dsts[b]);
+    }
+}
+
+#endif // SLICE_PLAN_TPP
@@ -0,0 +1,74 @@
+// src/slice_roi.h
+#ifndef SLICE_ROI_H
+#define SLICE_ROI_H
+
+#include "slice_index.h"
+#include "slice_nd.h"
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+// Batched multi-region extraction (gather) and slice assignment (scatter).
+
+// One region of interest: data[start0:stop0:step0, start1:stop1:step1,
+// start2:stop2:step2] with the usual Python rules (SLICE_NONE bounds,
+// negative indices and steps).
+struct SliceRoi {
+    int start0, stop0;
+    int start1, stop1;
+    int start2, stop2;
+    int step0 = 1, step1 = 1, step2 = 1;
+};
+
+// All regions back to back in one allocation. Region i occupies
+// data[offsets[i], offsets[i + 1]) and has shape shapes[i]; regions keep
+// the order in which they were requested.
+template <typename T>
+struct RoiBatch {
+    std::vector<T> data;
+    std::vector<size_t> offsets;
+    std::vector<std::array<size_t, 3>> shapes;
+
+    size_t count() const { return shapes.size(); }
+    const T* roi_data(size_t i) const { return data.data() + offsets[i]; }
+    size_t roi_size(size_t i) const { return offsets[i + 1] - offsets[i]; }
+};
+
+// Extracts every region in a single pass over the source. The work is
+// ordered by source plane rather than by region, so regions that overlap
+// (or just touch the same dim0 planes) are copied back to back while those
+// planes are still in cache. Each region is copied with its SliceNdPlan's
+// coalesced runs, so it takes the same fast paths as slice_3d_optimized.
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, RoiBatch<T>>::type
+slice_3d_multi(const std::vector<T>& data_1d,
+               size_t dim0, size_t dim1, size_t dim2,
+               const std::vector<SliceRoi>& rois);
+
+// data[start0:stop0, start1:stop1, start2:stop2] = patch, in place. patch
+// is the region in row-major order and must hold exactly as many elements
+// as the slice selects. Writes use the same coalesced runs as slicing.
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, void>::type
+assign_slice_3d(std::vector<T>& data_1d,
+                size_t dim0, size_t dim1, size_t dim2,
+                int start0, int stop0,
+                int start1, int stop1,
+                int start2, int stop2,
+                const std::vector<T>& patch);
+
+// Stepped variant: data[start0:stop0:step0, ...] = patch.
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, void>::type
+assign_slice_3d(std::vector<T>& data_1d,
+                size_t dim0, size_t dim1, size_t dim2,
+                int start0, int stop0, int step0,
+                int start1, int stop1, int step1,
+                int start2, int stop2, int step2,
+                const std::vector<T>& patch);
+
+// Include the implementation for templates
+#include "slice_roi.tpp"
+
+#endif // SLICE_ROI_H
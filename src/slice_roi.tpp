@@ -0,0 +1,130 @@
+// src/slice_roi.tpp
+#ifndef SLICE_ROI_TPP
+#define SLICE_ROI_TPP
+
+#include "slice_roi.h"
+#include "strided_copy.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace slice_3d_detail {
+
+// Output elements [out_begin, out_end) of one region, keyed by where they
+// start in the source.
+struct RoiTask {
+    std::ptrdiff_t src_offset;
+    size_t roi;
+    size_t out_begin;
+    size_t out_end;
+};
+
+} // namespace slice_3d_detail
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, RoiBatch<T>>::type
+slice_3d_multi(const std::vector<T>& data_1d,
+               size_t dim0, size_t dim1, size_t dim2,
+               const std::vector<SliceRoi>& rois) {
+    if (data_1d.size() != dim0 * dim1 * dim2) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+
+    // Plan every region up front so a bad one throws before any copy.
+    std::vector<SliceNdPlan<3>> plans;
+    plans.reserve(rois.size());
+    RoiBatch<T> batch;
+    batch.offsets.reserve(rois.size() + 1);
+    batch.shapes.reserve(rois.size());
+    batch.offsets.push_back(0);
+    size_t total_planes = 0;
+    for (const SliceRoi& roi : rois) {
+        plans.push_back(SliceNdPlan<3>({dim0, dim1, dim2},
+                                       {roi.start0, roi.start1, roi.start2},
+                                       {roi.stop0, roi.stop1, roi.stop2},
+                                       {roi.step0, roi.step1, roi.step2}));
+        const SliceNdPlan<3>& plan = plans.back();
+        batch.shapes.push_back(plan.output_shape());
+        batch.offsets.push_back(batch.offsets.back() + plan.output_size());
+        if (plan.output_size() != 0) {
+            total_planes += plan.output_shape()[0];
+        }
+    }
+    batch.data.resize(batch.offsets.back());
+
+    // One task per output plane, or per run when a coalesced run spans
+    // several planes (e.g. [a:b, :, :] stays one bulk copy). Tasks are
+    // sorted by source offset; the sort is stable so identical planes keep
+    // request order.
+    const std::ptrdiff_t plane_stride = static_cast<std::ptrdiff_t>(dim1 * dim2);
+    const std::ptrdiff_t row_stride = static_cast<std::ptrdiff_t>(dim2);
+    std::vector<slice_3d_detail::RoiTask> tasks;
+    tasks.reserve(total_planes);
+    for (size_t i = 0; i < plans.size(); ++i) {
+        const SliceNdPlan<3>& plan = plans[i];
+        if (plan.output_size() == 0) {
+            continue;
+        }
+        const size_t planes = plan.output_shape()[0];
+        const size_t plane_size = plan.output_size() / planes;
+        const size_t planes_per_task = std::max<size_t>(1, plan.run_length() / plane_size);
+        const std::ptrdiff_t origin = static_cast<std::ptrdiff_t>(plan.range(1).start) * row_stride +
+                                      static_cast<std::ptrdiff_t>(plan.range(2).start);
+        for (size_t p = 0; p < planes; p += planes_per_task) {
+            const std::ptrdiff_t s0 = static_cast<std::ptrdiff_t>(plan.range(0).start) +
+                                      static_cast<std::ptrdiff_t>(p) * plan.range(0).step;
+            tasks.push_back({s0 * plane_stride + origin, i,
+                             p * plane_size, std::min(p + planes_per_task, planes) * plane_size});
+        }
+    }
+    std::stable_sort(tasks.begin(), tasks.end(),
+                     [](const slice_3d_detail::RoiTask& a, const slice_3d_detail::RoiTask& b) {
+                         return a.src_offset < b.src_offset;
+                     });
+
+    for (const auto& task : tasks) {
+        plans[task.roi].execute_range(data_1d.data(), batch.data.data() + batch.offsets[task.roi],
+                                      task.out_begin, task.out_end);
+    }
+    return batch;
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, void>::type
+assign_slice_3d(std::vector<T>& data_1d,
+                size_t dim0, size_t dim1, size_t dim2,
+                int start0, int stop0,
+                int start1, int stop1,
+                int start2, int stop2,
+                const std::vector<T>& patch) {
+    assign_slice_3d(data_1d, dim0, dim1, dim2,
+                    start0, stop0, 1,
+                    start1, stop1, 1,
+                    start2, stop2, 1,
+                    patch);
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value, void>::type
+assign_slice_3d(std::vector<T>& data_1d,
+                size_t dim0, size_t dim1, size_t dim2,
+                int start0, int stop0, int step0,
+                int start1, int stop1, int step1,
+                int start2, int stop2, int step2,
+                const std::vector<T>& patch) {
+    if (data_1d.size() != dim0 * dim1 * dim2) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+    const SliceNdPlan<3> plan({dim0, dim1, dim2},
+                              {start0, start1, start2},
+                              {stop0, stop1, stop2},
+                              {step0, step1, step2});
+    if (patch.size() != plan.output_size()) {
+        throw std::invalid_argument("Patch size does not match the slice shape.");
+    }
+    plan.execute_range_with(data_1d.data(), patch.data(), 0, plan.output_size(),
+                            [](T* first, std::ptrdiff_t step, size_t n, const T* values) {
+                                strided_store(values, step, n, first);
+                            });
+}
+
+#endif // SLICE_ROI_TPP
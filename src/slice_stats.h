@@ -0,0 +1,113 @@
+// src/slice_stats.h
+#ifndef SLICE_STATS_H
+#define SLICE_STATS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// Which pattern a slice falls into, most contiguous first. Every slice runs
+// the same coalesced SliceNdPlan loop nest (see SliceNdPlan::path()); the
+// pattern is a label for reporting and routing, not a separate kernel.
+enum class SlicePath {
+    Empty,      // Some axis has length 0: nothing to copy.
+    FirstDim,   // data[a:b, :, :]   -> one bulk copy.
+    MiddleDim,  // data[:, a:b, :]   -> one copy per dim0 index.
+    LastDim,    // data[:, :, a:b]   -> one copy per (dim0, dim1) row.
+    General,    // Other unit steps  -> one copy per coalesced run.
+    Strided     // Some step != 1    -> strided runs or extra loops.
+};
+
+constexpr size_t SLICE_PATH_COUNT = 6;
+
+// "empty", "first_dim", "middle_dim", "last_dim", "general" or "strided".
+inline const char* slice_path_name(SlicePath path);
+
+// What a copy actually costs: the length of its innermost runs. Unit-stride
+// runs are bucketed by bytes per run; runs with a non-unit source stride go
+// through strided_copy and are counted separately.
+enum class SliceRunBucket {
+    Short,      // < 64 B per run: a cache line or less per copy call.
+    Medium,     // < 1 KiB
+    Long,       // < 16 KiB
+    Bulk,       // >= 16 KiB
+    Strided     // run_step() != 1
+};
+
+constexpr size_t SLICE_RUN_BUCKET_COUNT = 5;
+
+inline SliceRunBucket slice_run_bucket(size_t run_bytes, bool strided);
+
+// "short", "medium", "long", "bulk" or "strided".
+inline const char* slice_run_bucket_name(SliceRunBucket bucket);
+
+// --- Hot-path stats ---
+// Compiled in only when SLICE_3D_STATS is defined (e.g. -DSLICE_3D_STATS);
+// otherwise the counters stay zero and the hooks in SliceNdPlan::execute and
+// the parallel SlicePlan::execute expand to nothing, arguments included.
+// Counters are process-wide relaxed atomics, so the parallel path may update
+// them; a parallel execute counts as one call.
+struct SliceStatsCounters {
+    uint64_t calls = 0;
+    uint64_t runs = 0;         // Innermost runs copied (SliceNdPlan::run_count()).
+    uint64_t bytes = 0;        // Output bytes copied.
+    uint64_t nanoseconds = 0;  // Wall time inside the copy.
+};
+
+struct SliceStatsSnapshot {
+    std::array<SliceStatsCounters, SLICE_RUN_BUCKET_COUNT> by_run;
+    std::array<SliceStatsCounters, SLICE_PATH_COUNT> by_path;
+};
+
+constexpr bool slice_stats_enabled() {
+#ifdef SLICE_3D_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+inline SliceStatsSnapshot slice_stats_snapshot();
+inline void slice_stats_reset();
+
+// Per run-length bucket, then per path label: calls, runs, bytes per run,
+// MiB, ms and GB/s, for every row with at least one call.
+inline void print_slice_stats(std::ostream& os);
+
+namespace slice_3d_detail {
+
+// Adds one call to the bucket and path counters, timed from construction to
+// destruction.
+class SliceStatsScope {
+public:
+    SliceStatsScope(SlicePath path, size_t elem_size, size_t elements,
+                    size_t run_length, size_t run_count, bool strided);
+    ~SliceStatsScope();
+    SliceStatsScope(const SliceStatsScope&) = delete;
+    SliceStatsScope& operator=(const SliceStatsScope&) = delete;
+
+private:
+    SlicePath path_;
+    SliceRunBucket bucket_;
+    size_t runs_;
+    size_t bytes_;
+    int64_t start_ns_;
+};
+
+} // namespace slice_3d_detail
+
+// SLICE_3D_STATS_SCOPE(path, elem_size, elements, run_length, run_count, strided)
+#ifdef SLICE_3D_STATS
+#define SLICE_3D_STATS_CAT_(a, b) a##b
+#define SLICE_3D_STATS_CAT(a, b) SLICE_3D_STATS_CAT_(a, b)
+#define SLICE_3D_STATS_SCOPE(...) \
+    const slice_3d_detail::SliceStatsScope SLICE_3D_STATS_CAT(slice_stats_scope_, __LINE__)(__VA_ARGS__)
+#else
+#define SLICE_3D_STATS_SCOPE(...) ((void)0)
+#endif
+
+// Include the implementation for templates
+#include "slice_stats.tpp"
+
+#endif // SLICE_STATS_H
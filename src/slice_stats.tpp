@@ -0,0 +1,163 @@
+// src/slice_stats.tpp
+#ifndef SLICE_STATS_TPP
+#define SLICE_STATS_TPP
+
+#include "slice_stats.h"
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+
+inline const char* slice_path_name(SlicePath path) {
+    switch (path) {
+        case SlicePath::Empty: return "empty";
+        case SlicePath::FirstDim: return "first_dim";
+        case SlicePath::MiddleDim: return "middle_dim";
+        case SlicePath::LastDim: return "last_dim";
+        case SlicePath::General: return "general";
+        case SlicePath::Strided: return "strided";
+    }
+    return "unknown";
+}
+
+inline SliceRunBucket slice_run_bucket(size_t run_bytes, bool strided) {
+    if (strided) {
+        return SliceRunBucket::Strided;
+    } else if (run_bytes < 64) {
+        return SliceRunBucket::Short;
+    } else if (run_bytes < 1024) {
+        return SliceRunBucket::Medium;
+    } else if (run_bytes < 16 * 1024) {
+        return SliceRunBucket::Long;
+    }
+    return SliceRunBucket::Bulk;
+}
+
+inline const char* slice_run_bucket_name(SliceRunBucket bucket) {
+    switch (bucket) {
+        case SliceRunBucket::Short: return "short";
+        case SliceRunBucket::Medium: return "medium";
+        case SliceRunBucket::Long: return "long";
+        case SliceRunBucket::Bulk: return "bulk";
+        case SliceRunBucket::Strided: return "strided";
+    }
+    return "unknown";
+}
+
+namespace slice_3d_detail {
+
+struct AtomicSliceCounters {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> runs{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> nanoseconds{0};
+
+    void add(uint64_t run_count, uint64_t byte_count, uint64_t ns) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        runs.fetch_add(run_count, std::memory_order_relaxed);
+        bytes.fetch_add(byte_count, std::memory_order_relaxed);
+        nanoseconds.fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    SliceStatsCounters load() const {
+        SliceStatsCounters c;
+        c.calls = calls.load(std::memory_order_relaxed);
+        c.runs = runs.load(std::memory_order_relaxed);
+        c.bytes = bytes.load(std::memory_order_relaxed);
+        c.nanoseconds = nanoseconds.load(std::memory_order_relaxed);
+        return c;
+    }
+
+    void reset() {
+        calls.store(0, std::memory_order_relaxed);
+        runs.store(0, std::memory_order_relaxed);
+        bytes.store(0, std::memory_order_relaxed);
+        nanoseconds.store(0, std::memory_order_relaxed);
+    }
+};
+
+struct AtomicSliceStats {
+    std::array<AtomicSliceCounters, SLICE_RUN_BUCKET_COUNT> by_run;
+    std::array<AtomicSliceCounters, SLICE_PATH_COUNT> by_path;
+};
+
+inline AtomicSliceStats& stats_table() {
+    static AtomicSliceStats table;
+    return table;
+}
+
+inline int64_t stats_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline SliceStatsScope::SliceStatsScope(SlicePath path, size_t elem_size, size_t elements,
+                                        size_t run_length, size_t run_count, bool strided)
+    : path_(path),
+      bucket_(slice_run_bucket(run_length * elem_size, strided)),
+      runs_(run_count),
+      bytes_(elements * elem_size),
+      start_ns_(stats_now_ns()) {}
+
+inline SliceStatsScope::~SliceStatsScope() {
+    const uint64_t ns = static_cast<uint64_t>(stats_now_ns() - start_ns_);
+    AtomicSliceStats& table = stats_table();
+    table.by_run[static_cast<size_t>(bucket_)].add(runs_, bytes_, ns);
+    table.by_path[static_cast<size_t>(path_)].add(runs_, bytes_, ns);
+}
+
+inline void print_stats_rows(std::ostream& os, const char* title, const SliceStatsCounters* rows,
+                             size_t count, const char* (*row_name)(size_t)) {
+    os << std::left << std::setw(12) << title << std::right
+       << std::setw(12) << "calls" << std::setw(14) << "runs" << std::setw(12) << "B/run"
+       << std::setw(12) << "MiB" << std::setw(12) << "ms" << std::setw(10) << "GB/s" << "\n";
+    for (size_t i = 0; i < count; ++i) {
+        const SliceStatsCounters& s = rows[i];
+        if (s.calls == 0) {
+            continue;
+        }
+        const double bytes = static_cast<double>(s.bytes);
+        os << std::left << std::setw(12) << row_name(i) << std::right
+           << std::setw(12) << s.calls
+           << std::setw(14) << s.runs
+           << std::setw(12) << std::setprecision(1) << (s.runs > 0 ? bytes / static_cast<double>(s.runs) : 0.0)
+           << std::setw(12) << std::setprecision(1) << bytes / (1 << 20)
+           << std::setw(12) << std::setprecision(3) << static_cast<double>(s.nanoseconds) / 1e6
+           << std::setw(10) << std::setprecision(2)
+           << (s.nanoseconds > 0 ? bytes / static_cast<double>(s.nanoseconds) : 0.0) << "\n";
+    }
+}
+
+} // namespace slice_3d_detail
+
+inline SliceStatsSnapshot slice_stats_snapshot() {
+    SliceStatsSnapshot snapshot;
+    const auto& table = slice_3d_detail::stats_table();
+    for (size_t b = 0; b < SLICE_RUN_BUCKET_COUNT; ++b) snapshot.by_run[b] = table.by_run[b].load();
+    for (size_t p = 0; p < SLICE_PATH_COUNT; ++p) snapshot.by_path[p] = table.by_path[p].load();
+    return snapshot;
+}
+
+inline void slice_stats_reset() {
+    auto& table = slice_3d_detail::stats_table();
+    for (auto& entry : table.by_run) entry.reset();
+    for (auto& entry : table.by_path) entry.reset();
+}
+
+inline void print_slice_stats(std::ostream& os) {
+    if (!slice_stats_enabled()) {
+        os << "slice stats disabled (build with -DSLICE_3D_STATS)\n";
+        return;
+    }
+    const SliceStatsSnapshot snapshot = slice_stats_snapshot();
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed;
+    slice_3d_detail::print_stats_rows(os, "run", snapshot.by_run.data(), SLICE_RUN_BUCKET_COUNT,
+                                      [](size_t i) { return slice_run_bucket_name(static_cast<SliceRunBucket>(i)); });
+    slice_3d_detail::print_stats_rows(os, "path", snapshot.by_path.data(), SLICE_PATH_COUNT,
+                                      [](size_t i) { return slice_path_name(static_cast<SlicePath>(i)); });
+    os.flags(flags);
+    os.precision(precision);
+}
+
+#endif // SLICE_STATS_TPP
@@ -0,0 +1,67 @@
+// src/slice_stream.h
+#ifndef SLICE_STREAM_H
+#define SLICE_STREAM_H
+
+#include "slice_index.h"
+#include "slice_io.h"
+#include <string>
+#include <cstddef>
+#include <type_traits>
+
+// Out-of-core slicing of a row-major 3D array stored in a file (raw binary or
+// .npy), for volumes that do not fit in memory.
+//
+// Only the dim0 planes the slice selects are read, and within each plane only
+// the span of dim1 rows it touches. Planes are read with pread in chunks,
+// each chunk is sliced into an output buffer, and the buffer is handed to a
+// sink before the next chunk is processed. With double buffering one
+// long-lived reader thread reads the next chunk while the current one is
+// sliced, so I/O overlaps the copy. Memory use is bounded by
+// StreamOptions::max_buffer_bytes.
+struct StreamOptions {
+    // Upper bound on buffered bytes (input chunk buffers plus the output
+    // chunk). Chunks never go below one dim0 plane, so a single plane larger
+    // than this is still buffered whole. A few MiB keeps chunks cache-resident
+    // while reads stay large enough for sequential disk bandwidth.
+    size_t max_buffer_bytes = size_t(4) << 20;
+    // Read the next chunk while the current one is sliced (two input buffers).
+    bool double_buffer = true;
+};
+
+// Streams data[start0:stop0:step0, start1:stop1:step1, start2:stop2:step2]
+// (NumPy semantics) of the dim0 x dim1 x dim2 array of T stored at
+// data_offset in filename. sink(const T* data, size_t count) is called with
+// consecutive pieces of the output in row-major order; each piece is valid
+// only for the duration of the call.
+template <typename T, typename Sink>
+void slice_3d_stream(const std::string& filename, size_t data_offset,
+                     size_t dim0, size_t dim1, size_t dim2,
+                     int start0, int stop0, int step0,
+                     int start1, int stop1, int step1,
+                     int start2, int stop2, int step2,
+                     Sink&& sink,
+                     const StreamOptions& options = StreamOptions());
+
+// Same, reading shape and data offset from a rank-3 .npy file whose dtype
+// matches T.
+template <typename T, typename Sink>
+void slice_npy_stream(const std::string& filename,
+                      int start0, int stop0, int step0,
+                      int start1, int stop1, int step1,
+                      int start2, int stop2, int step2,
+                      Sink&& sink,
+                      const StreamOptions& options = StreamOptions());
+
+// Disk to disk: slices a rank-3 .npy file into a new .npy file without ever
+// holding either array in memory.
+template <typename T>
+void slice_npy_stream_to_npy(const std::string& in_filename, const std::string& out_filename,
+                             int start0, int stop0, int step0,
+                             int start1, int stop1, int step1,
+                             int start2, int stop2, int step2,
+                             const StreamOptions& options = StreamOptions());
+
+// Include the implementation for templates
+#include "slice_stream.tpp"
+
+#endif // SLICE_STREAM_H
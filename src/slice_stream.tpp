@@ -0,0 +1,333 @@
+// src/slice_stream.tpp
+#ifndef SLICE_STREAM_TPP
+#define SLICE_STREAM_TPP
+
+#include "slice_stream.h"
+#include "strided_copy.h"
+#include <algorithm>
+#include <stdexcept>
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <cerrno>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace slice_3d_detail {
+
+// Read-only file descriptor for pread access; closed on scope exit.
+class PreadFile {
+public:
+    explicit PreadFile(const std::string& filename) : filename_(filename) {
+#if defined(__unix__) || defined(__APPLE__)
+        fd_ = ::open(filename.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            throw std::runtime_error("Could not open file for reading: " + filename);
+        }
+#else
+        throw std::runtime_error("Streaming slices are not supported on this platform: " + filename);
+#endif
+    }
+
+    ~PreadFile() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (fd_ >= 0) ::close(fd_);
+#endif
+    }
+
+    PreadFile(const PreadFile&) = delete;
+    PreadFile& operator=(const PreadFile&) = delete;
+
+    size_t size() const {
+#if defined(__unix__) || defined(__APPLE__)
+        struct stat st;
+        if (::fstat(fd_, &st) != 0) {
+            throw std::runtime_error("Could not stat file: " + filename_);
+        }
+        return static_cast<size_t>(st.st_size);
+#else
+        return 0;
+#endif
+    }
+
+    void advise_sequential() const {
+#if defined(POSIX_FADV_SEQUENTIAL)
+        ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    }
+
+    // Reads exactly bytes at offset, retrying short reads and EINTR.
+    void read_at(void* dst, size_t bytes, size_t offset) const {
+#if defined(__unix__) || defined(__APPLE__)
+        char* p = static_cast<char*>(dst);
+        while (bytes > 0) {
+            const ssize_t n = ::pread(fd_, p, bytes, static_cast<off_t>(offset));
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                throw std::runtime_error("Failed reading file: " + filename_);
+            }
+            p += n;
+            bytes -= static_cast<size_t>(n);
+            offset += static_cast<size_t>(n);
+        }
+#else
+        (void)dst; (void)bytes; (void)offset;
+#endif
+    }
+
+private:
+    std::string filename_;
+    int fd_ = -1;
+};
+
+// Background reader for double buffering. One long-lived thread reads chunk
+// c into buffer c % 2 as soon as the caller has released chunk c - 2, and the
+// caller takes the chunks in order. The destructor stops and joins the
+// thread, also when slicing or the sink throws mid-stream.
+class DoubleBufferReader {
+public:
+    // read(chunk) fills the buffer of chunk; it runs on the reader thread.
+    template <typename ReadFn>
+    DoubleBufferReader(size_t chunks, ReadFn read)
+        : thread_([this, chunks, read]() { run(chunks, read); }) {}
+
+    ~DoubleBufferReader() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        thread_.join();
+    }
+
+    DoubleBufferReader(const DoubleBufferReader&) = delete;
+    DoubleBufferReader& operator=(const DoubleBufferReader&) = delete;
+
+    // Blocks until chunk has been read; rethrows the reader's exception.
+    void wait(size_t chunk) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&]() { return filled_ > chunk || error_; });
+        if (filled_ <= chunk) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+    // The caller is done with chunk; its buffer may be refilled.
+    void release(size_t chunk) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            released_ = chunk + 1;
+        }
+        cv_.notify_all();
+    }
+
+private:
+    template <typename ReadFn>
+    void run(size_t chunks, const ReadFn& read) {
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&]() { return stop_ || chunk < released_ + 2; });
+                if (stop_) {
+                    return;
+                }
+            }
+            try {
+                read(chunk);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                error_ = std::current_exception();
+                cv_.notify_all();
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                filled_ = chunk + 1;
+            }
+            cv_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t filled_ = 0;    // Chunks [0, filled_) are in their buffers.
+    size_t released_ = 0;  // Chunks [0, released_) are done with.
+    bool stop_ = false;
+    std::exception_ptr error_;
+    // Last member: started once the state above is initialized.
+    std::thread thread_;
+};
+
+inline void require_rank_3(const NpyHeader& header, const std::string& filename) {
+    if (header.shape.size() != 3) {
+        throw std::invalid_argument("Streaming slice requires a rank-3 .npy file: " + filename);
+    }
+}
+
+} // namespace slice_3d_detail
+
+template <typename T, typename Sink>
+void slice_3d_stream(const std::string& filename, size_t data_offset,
+                     size_t dim0, size_t dim1, size_t dim2,
+                     int start0, int stop0, int step0,
+                     int start1, int stop1, int step1,
+                     int start2, int stop2, int step2,
+                     Sink&& sink,
+                     const StreamOptions& options) {
+    static_assert(std::is_arithmetic<T>::value, "slice_3d_stream requires an arithmetic element type.");
+
+    const SliceRange r0 = normalize_slice(start0, stop0, step0, dim0);
+    const SliceRange r1 = normalize_slice(start1, stop1, step1, dim1);
+    const SliceRange r2 = normalize_slice(start2, stop2, step2, dim2);
+
+    const slice_3d_detail::PreadFile file(filename);
+    const size_t elements = slice_3d_detail::checked_element_count({dim0, dim1, dim2}, sizeof(T));
+    if (file.size() < data_offset || (file.size() - data_offset) / sizeof(T) < elements) {
+        throw std::invalid_argument("Data size does not match provided dimensions.");
+    }
+    if (r0.length == 0 || r1.length == 0 || r2.length == 0) {
+        return;
+    }
+
+    // --- Per-plane footprint ---
+    // Rows [row_lo, row_lo + span_rows) of each selected plane hold every
+    // element the slice needs; only those are read.
+    const std::ptrdiff_t row_first = static_cast<std::ptrdiff_t>(r1.start);
+    const std::ptrdiff_t row_last = row_first + static_cast<std::ptrdiff_t>(r1.length - 1) * r1.step;
+    const size_t row_lo = static_cast<size_t>(std::min(row_first, row_last));
+    const size_t span_rows = static_cast<size_t>(std::max(row_first, row_last)) - row_lo + 1;
+    const size_t plane_in = span_rows * dim2;
+    const size_t plane_out = r1.length * r2.length;
+
+    // --- Chunk size from the memory budget ---
+    const size_t buffers = options.double_buffer ? 2 : 1;
+    const size_t plane_bytes = (buffers * plane_in + plane_out) * sizeof(T);
+    const size_t planes_per_chunk = std::max<size_t>(1, std::min(r0.length, options.max_buffer_bytes / plane_bytes));
+    const size_t chunks = (r0.length + planes_per_chunk - 1) / planes_per_chunk;
+
+    // Whole consecutive planes are one contiguous span of the file.
+    const bool contiguous = r0.step == 1 && span_rows == dim1;
+    if (r0.step > 0) {
+        file.advise_sequential();
+    }
+
+    auto read_chunk = [&](size_t chunk, T* buf) {
+        const size_t first = chunk * planes_per_chunk;
+        const size_t count = std::min(planes_per_chunk, r0.length - first);
+        if (contiguous) {
+            const size_t offset = data_offset + (r0.start + first) * dim1 * dim2 * sizeof(T);
+            file.read_at(buf, count * plane_in * sizeof(T), offset);
+            return;
+        }
+        for (size_t j = 0; j < count; ++j) {
+            const std::ptrdiff_t plane = static_cast<std::ptrdiff_t>(r0.start) +
+                                         static_cast<std::ptrdiff_t>(first + j) * r0.step;
+            const size_t offset = data_offset + (static_cast<size_t>(plane) * dim1 + row_lo) * dim2 * sizeof(T);
+            file.read_at(buf + j * plane_in, plane_in * sizeof(T), offset);
+        }
+    };
+
+    std::vector<T> in_buf[2];
+    for (size_t b = 0; b < buffers; ++b) {
+        in_buf[b].resize(planes_per_chunk * plane_in);
+    }
+    std::vector<T> out_buf(planes_per_chunk * plane_out);
+
+    auto slice_chunk = [&](size_t chunk, const T* buf) {
+        const size_t count = std::min(planes_per_chunk, r0.length - chunk * planes_per_chunk);
+        const std::ptrdiff_t first_row = row_first - static_cast<std::ptrdiff_t>(row_lo);
+        T* out = out_buf.data();
+        for (size_t j = 0; j < count; ++j) {
+            const T* plane = buf + j * plane_in + r2.start;
+            for (size_t c = 0; c < r1.length; ++c, out += r2.length) {
+                const std::ptrdiff_t row = first_row + static_cast<std::ptrdiff_t>(c) * r1.step;
+                strided_copy(plane + row * static_cast<std::ptrdiff_t>(dim2), r2.step, r2.length, out);
+            }
+        }
+        sink(static_cast<const T*>(out_buf.data()), count * plane_out);
+    };
+
+    if (!options.double_buffer) {
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            read_chunk(chunk, in_buf[0].data());
+            slice_chunk(chunk, in_buf[0].data());
+        }
+        return;
+    }
+
+    // Declared after the buffers: if slicing or the sink throws, the reader
+    // thread is stopped and joined before the buffers are released.
+    slice_3d_detail::DoubleBufferReader reader(chunks, [&](size_t chunk) {
+        read_chunk(chunk, in_buf[chunk % 2].data());
+    });
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        reader.wait(chunk);
+        slice_chunk(chunk, in_buf[chunk % 2].data());
+        reader.release(chunk);
+    }
+}
+
+template <typename T, typename Sink>
+void slice_npy_stream(const std::string& filename,
+                      int start0, int stop0, int step0,
+                      int start1, int stop1, int step1,
+                      int start2, int stop2, int step2,
+                      Sink&& sink,
+                      const StreamOptions& options) {
+    const NpyHeader header = read_npy_header(filename);
+    slice_3d_detail::check_npy_header<T>(header, filename);
+    slice_3d_detail::require_rank_3(header, filename);
+    slice_3d_stream<T>(filename, header.data_offset,
+                       header.shape[0], header.shape[1], header.shape[2],
+                       start0, stop0, step0,
+                       start1, stop1, step1,
+                       start2, stop2, step2,
+                       std::forward<Sink>(sink), options);
+}
+
+template <typename T>
+void slice_npy_stream_to_npy(const std::string& in_filename, const std::string& out_filename,
+                             int start0, int stop0, int step0,
+                             int start1, int stop1, int step1,
+                             int start2, int stop2, int step2,
+                             const StreamOptions& options) {
+    const NpyHeader header = read_npy_header(in_filename);
+    slice_3d_detail::check_npy_header<T>(header, in_filename);
+    slice_3d_detail::require_rank_3(header, in_filename);
+
+    const std::vector<size_t> out_shape = {
+        normalize_slice(start0, stop0, step0, header.shape[0]).length,
+        normalize_slice(start1, stop1, step1, header.shape[1]).length,
+        normalize_slice(start2, stop2, step2, header.shape[2]).length,
+    };
+
+    std::ofstream out(out_filename, std::ios::binary);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open file for writing: " + out_filename);
+    }
+    write_npy_header<T>(out, out_shape);
+    slice_3d_stream<T>(in_filename, header.data_offset,
+                       header.shape[0], header.shape[1], header.shape[2],
+                       start0, stop0, step0,
+                       start1, stop1, step1,
+                       start2, stop2, step2,
+                       [&out](const T* data, size_t count) {
+                           out.write(reinterpret_cast<const char*>(data),
+                                     static_cast<std::streamsize>(count * sizeof(T)));
+                       },
+                       options);
+    if (!out) {
+        throw std::runtime_error("Failed writing file: " + out_filename);
+    }
+}
+
+#endif // SLICE_STREAM_TPP
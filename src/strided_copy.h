@@ -0,0 +1,40 @@
+// src/strided_copy.h
+#ifndef STRIDED_COPY_H
+#define STRIDED_COPY_H
+
+#include <cstddef>
+#include <type_traits>
+
+// Strided gather used for the innermost axis of stepped slices:
+//   dst[i] = src[i * step]  for i in [0, count)
+// step may be negative (src then points at the first element to copy, which
+// is the highest address). step == 1 is a plain copy.
+//
+// On x86-64 with GCC/Clang every element size has a reversal kernel for
+// step -1, and 1-, 2- and 4-byte types (e.g. uint8, int16, float) have
+// shuffle / permute kernels for step 2 and 4. With AVX2, 4- and 8-byte types
+// use gathers for other steps; 8-byte steps 2 and 4 stay on the scalar loop,
+// which is faster there. The kernel width is selected at runtime: AVX2, else
+// SSE2 for 4- and 8-byte types (the x86-64 baseline) and SSSE3 for 1- and
+// 2-byte types, else the scalar loop.
+// Other platforms use the scalar loop. Define SLICE_3D_NO_SIMD to force the
+// scalar loop everywhere.
+template <typename T>
+void strided_copy(const T* src, std::ptrdiff_t step, size_t count, T* dst);
+
+// Strided scatter, the inverse of strided_copy:
+//   dst[i * step] = src[i]  for i in [0, count)
+// step 1 is a plain copy and step -1 reuses the strided_copy reversal
+// kernels; other steps use the scalar loop (x86 has no scatter before
+// AVX-512).
+template <typename T>
+void strided_store(const T* src, std::ptrdiff_t step, size_t count, T* dst);
+
+// Name of the kernel family strided_copy dispatches to on this machine:
+// "avx2", "ssse3", "sse2" or "scalar".
+inline const char* strided_copy_isa();
+
+// Include the implementation for templates
+#include "strided_copy.tpp"
+
+#endif // STRIDED_COPY_H
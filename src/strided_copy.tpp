@@ -0,0 +1,361 @@
+// src/strided_copy.tpp
+#ifndef STRIDED_COPY_TPP
+#define STRIDED_COPY_TPP
+
+#include "strided_copy.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#if !defined(SLICE_3D_NO_SIMD) && defined(__x86_64__) && defined(__GNUC__)
+#define SLICE_3D_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace slice_3d_detail {
+
+template <typename T>
+inline void strided_copy_scalar(const T* src, std::ptrdiff_t step, size_t count, T* dst) {
+    // Unrolled by four: independent loads keep the loop from being bound
+    // by the pointer increment chain.
+    const size_t blocks = count / 4;
+    for (size_t b = 0; b < blocks; ++b, src += 4 * step, dst += 4) {
+        const T v0 = src[0], v1 = src[step], v2 = src[2 * step], v3 = src[3 * step];
+        dst[0] = v0;
+        dst[1] = v1;
+        dst[2] = v2;
+        dst[3] = v3;
+    }
+    for (size_t i = 0; i < count % 4; ++i, src += step) {
+        dst[i] = *src;
+    }
+}
+
+#ifdef SLICE_3D_X86_SIMD
+
+inline bool cpu_has_avx2() {
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return has_avx2;
+}
+
+inline bool cpu_has_ssse3() {
+    static const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+    return has_ssse3;
+}
+
+// Gather indices are 32-bit: lane k reads src[k * step] for k < 8.
+inline bool step_fits_gather(std::ptrdiff_t step) {
+    const std::ptrdiff_t limit = std::numeric_limits<int32_t>::max() / 8;
+    return step >= -limit && step <= limit;
+}
+
+// The vector kernels below return how many leading elements they copied;
+// the caller finishes the tail with the scalar loop on the real element type.
+// Every vector loop leaves at least the last element to the tail whenever a
+// full-width load would read past src[(count - 1) * step].
+
+// --- 4-byte elements ---
+
+inline size_t strided_copy_32_sse2(const uint32_t* src, std::ptrdiff_t step, size_t count, uint32_t* dst) {
+    size_t i = 0;
+    if (step == -1) {
+        for (; i + 4 <= count; i += 4) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src - i - 3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)));
+        }
+    } else if (step == 2) {
+        for (; i + 5 <= count; i += 4) {
+            const float* p = reinterpret_cast<const float*>(src + 2 * i);
+            const __m128 a = _mm_loadu_ps(p);
+            const __m128 b = _mm_loadu_ps(p + 4);
+            _mm_storeu_ps(reinterpret_cast<float*>(dst + i), _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        }
+    } else if (step == 4) {
+        for (; i + 5 <= count; i += 4) {
+            const __m128i* p = reinterpret_cast<const __m128i*>(src + 4 * i);
+            const __m128i ab = _mm_unpacklo_epi32(_mm_loadu_si128(p), _mm_loadu_si128(p + 1));
+            const __m128i cd = _mm_unpacklo_epi32(_mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi64(ab, cd));
+        }
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline size_t strided_copy_32_avx2(const uint32_t* src, std::ptrdiff_t step, size_t count, uint32_t* dst) {
+    size_t i = 0;
+    if (step == -1) {
+        const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        for (; i + 8 <= count; i += 8) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src - i - 7));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permutevar8x32_epi32(v, reverse));
+        }
+    } else if (step == 2) {
+        for (; i + 9 <= count; i += 8) {
+            const float* p = reinterpret_cast<const float*>(src + 2 * i);
+            // Per 128-bit lane: a0 a2 b0 b2 | a4 a6 b4 b6, then fix the lane order.
+            const __m256 even = _mm256_shuffle_ps(_mm256_loadu_ps(p), _mm256_loadu_ps(p + 8), _MM_SHUFFLE(2, 0, 2, 0));
+            const __m256d ordered = _mm256_permute4x64_pd(_mm256_castps_pd(even), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_pd(reinterpret_cast<double*>(dst + i), ordered);
+        }
+    } else if (step == 4) {
+        // Element 0 of every 128-bit lane of the four loads. The unpacks
+        // leave outputs 0 2 4 6 in the low lane and 1 3 5 7 in the high lane.
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        for (; i + 9 <= count; i += 8) {
+            const __m256i* p = reinterpret_cast<const __m256i*>(src + 4 * i);
+            const __m256i ab = _mm256_unpacklo_epi32(_mm256_loadu_si256(p), _mm256_loadu_si256(p + 1));
+            const __m256i cd = _mm256_unpacklo_epi32(_mm256_loadu_si256(p + 2), _mm256_loadu_si256(p + 3));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                                _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(ab, cd), order));
+        }
+    } else if (step_fits_gather(step)) {
+        const int s = static_cast<int>(step);
+        const __m256i index = _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+        for (; i + 8 <= count; i += 8) {
+            const int* base = reinterpret_cast<const int*>(src + static_cast<std::ptrdiff_t>(i) * step);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_i32gather_epi32(base, index, 4));
+        }
+    }
+    return i;
+}
+
+// --- 8-byte elements ---
+// Steps 2 and 4 have no vector kernel: the unrolled scalar loop is already
+// bound by one load per element, and every shuffle variant measured slower.
+
+inline size_t strided_copy_64_sse2(const uint64_t* src, std::ptrdiff_t step, size_t count, uint64_t* dst) {
+    size_t i = 0;
+    if (step == -1) {
+        for (; i + 2 <= count; i += 2) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src - i - 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+        }
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline size_t strided_copy_64_avx2(const uint64_t* src, std::ptrdiff_t step, size_t count, uint64_t* dst) {
+    size_t i = 0;
+    if (step == -1) {
+        for (; i + 4 <= count; i += 4) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src - i - 3));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permute4x64_epi64(v, _MM_SHUFFLE(0, 1, 2, 3)));
+        }
+    } else if (step != 2 && step != 4 && step_fits_gather(step)) {
+        const int s = static_cast<int>(step);
+        const __m128i index = _mm_setr_epi32(0, s, 2 * s, 3 * s);
+        for (; i + 4 <= count; i += 4) {
+            const long long* base = reinterpret_cast<const long long*>(src + static_cast<std::ptrdiff_t>(i) * step);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_i32gather_epi64(base, index, 8));
+        }
+    }
+    return i;
+}
+
+// --- 2-byte elements ---
+// No gathers here: a 32-bit gather lane would read past the last element.
+
+__attribute__((target("ssse3")))
+inline size_t strided_copy_16_ssse3(const uint16_t* src, std::ptrdiff_t step, size_t count, uint16_t* dst) {
+    size_t i = 0;
+    if (step == -1) {
+        const __m128i reverse = _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+        for (; i + 8 <= count; i += 8) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src - i - 7));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, reverse));
+        }
+    } else if (step == 2) {
+        // Even words of each vector into its low half, then join the halves.
+        const __m128i even = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+        for (; i + 9 <= count; i += 8) {
+            const __m128i* p = reinterpret_cast<const __m128i*>(src + 2 * i);
+            const __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(p), even);
+            const __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(p + 1), even);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi64(a, b));
+        }
+    } else if (step == 4) {
+        // Words 0 and 4 of each vector into its low 32 bits.
+        const __m128i pick = _mm_setr_epi8(0, 1, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+        for (; i + 9 <= count; i += 8) {
+            const __m128i* p = reinterpret_cast<const __m128i*>(src + 4 * i);
+            const __m128i ab = _mm_unpacklo_epi32(_mm_shuffle_epi8(_mm_loadu_si128(p), pick),
+                                                  _mm_shuffle_epi8(_mm_loadu_si128(p + 1), pick));
+            const __m128i cd = _mm_unpacklo_epi32(_mm_shuffle_epi8(_mm_loadu_si128(p + 2), pick),
+                                                  _mm_shuffle_epi8(_mm_loadu_si128(p + 3), pick));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi64(ab, cd));
+        }
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline size_t strided_copy_16_avx2(const uint16_t* src, std::ptrdiff_t step, size_t count, uint16_t* dst) {
+    size_t i = 0;
+    if (step == -1) {
+        // vpshufb reverses within each 128-bit lane; the permute swaps lanes.
+        const __m256i reverse = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                                                 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+        for (; i + 16 <= count; i += 16) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src - i - 15));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                                _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, reverse), _MM_SHUFFLE(1, 0, 3, 2)));
+        }
+    } else if (step == 2) {
+        const __m256i even = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+                                              0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+        for (; i + 17 <= count; i += 16) {
+            const __m256i* p = reinterpret_cast<const __m256i*>(src + 2 * i);
+            const __m256i a = _mm256_shuffle_epi8(_mm256_loadu_si256(p), even);
+            const __m256i b = _mm256_shuffle_epi8(_mm256_loadu_si256(p + 1), even);
+            // Per lane: a_lo b_lo | a_hi b_hi, then fix the quarter order.
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                                _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+    }
+    return i + strided_copy_16_ssse3(src + static_cast<std::ptrdiff_t>(i) * step, step, count - i, dst + i);
+}
+
+// --- 1-byte elements ---
+
+__attribute__((target("ssse3")))
+inline size_t strided_copy_8_ssse3(const uint8_t* src, std::ptrdiff_t step, size_t count, uint8_t* dst) {
+    size_t i = 0;
+    if (step == -1) {
+        const __m128i reverse = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        for (; i + 16 <= count; i += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src - i - 15));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, reverse));
+        }
+    } else if (step == 2) {
+        const __m128i even = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1);
+        for (; i + 17 <= count; i += 16) {
+            const __m128i* p = reinterpret_cast<const __m128i*>(src + 2 * i);
+            const __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(p), even);
+            const __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(p + 1), even);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi64(a, b));
+        }
+    } else if (step == 4) {
+        const __m128i pick = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+        for (; i + 17 <= count; i += 16) {
+            const __m128i* p = reinterpret_cast<const __m128i*>(src + 4 * i);
+            const __m128i ab = _mm_unpacklo_epi32(_mm_shuffle_epi8(_mm_loadu_si128(p), pick),
+                                                  _mm_shuffle_epi8(_mm_loadu_si128(p + 1), pick));
+            const __m128i cd = _mm_unpacklo_epi32(_mm_shuffle_epi8(_mm_loadu_si128(p + 2), pick),
+                                                  _mm_shuffle_epi8(_mm_loadu_si128(p + 3), pick));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi64(ab, cd));
+        }
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline size_t strided_copy_8_avx2(const uint8_t* src, std::ptrdiff_t step, size_t count, uint8_t* dst) {
+    size_t i = 0;
+    if (step == -1) {
+        const __m256i reverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                                 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        for (; i + 32 <= count; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src - i - 31));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                                _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, reverse), _MM_SHUFFLE(1, 0, 3, 2)));
+        }
+    } else if (step == 2) {
+        const __m256i even = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1,
+                                              0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1);
+        for (; i + 33 <= count; i += 32) {
+            const __m256i* p = reinterpret_cast<const __m256i*>(src + 2 * i);
+            const __m256i a = _mm256_shuffle_epi8(_mm256_loadu_si256(p), even);
+            const __m256i b = _mm256_shuffle_epi8(_mm256_loadu_si256(p + 1), even);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                                _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+    }
+    return i + strided_copy_8_ssse3(src + static_cast<std::ptrdiff_t>(i) * step, step, count - i, dst + i);
+}
+
+#endif // SLICE_3D_X86_SIMD
+
+} // namespace slice_3d_detail
+
+template <typename T>
+void strided_copy(const T* src, std::ptrdiff_t step, size_t count, T* dst) {
+    if (count == 0) {
+        return;
+    }
+    if (step == 1) {
+        std::copy(src, src + count, dst);
+        return;
+    }
+#ifdef SLICE_3D_X86_SIMD
+    // Elements are moved bit-for-bit, so any 1/2/4/8-byte arithmetic type can
+    // go through the unsigned-integer kernels (intrinsic loads/stores may
+    // alias any type).
+    size_t done = 0;
+    if constexpr (std::is_arithmetic<T>::value && sizeof(T) == 4) {
+        const uint32_t* s = reinterpret_cast<const uint32_t*>(src);
+        uint32_t* d = reinterpret_cast<uint32_t*>(dst);
+        done = slice_3d_detail::cpu_has_avx2() ? slice_3d_detail::strided_copy_32_avx2(s, step, count, d)
+                                               : slice_3d_detail::strided_copy_32_sse2(s, step, count, d);
+    } else if constexpr (std::is_arithmetic<T>::value && sizeof(T) == 8) {
+        const uint64_t* s = reinterpret_cast<const uint64_t*>(src);
+        uint64_t* d = reinterpret_cast<uint64_t*>(dst);
+        done = slice_3d_detail::cpu_has_avx2() ? slice_3d_detail::strided_copy_64_avx2(s, step, count, d)
+                                               : slice_3d_detail::strided_copy_64_sse2(s, step, count, d);
+    } else if constexpr (std::is_arithmetic<T>::value && sizeof(T) == 2) {
+        const uint16_t* s = reinterpret_cast<const uint16_t*>(src);
+        uint16_t* d = reinterpret_cast<uint16_t*>(dst);
+        if (slice_3d_detail::cpu_has_avx2()) {
+            done = slice_3d_detail::strided_copy_16_avx2(s, step, count, d);
+        } else if (slice_3d_detail::cpu_has_ssse3()) {
+            done = slice_3d_detail::strided_copy_16_ssse3(s, step, count, d);
+        }
+    } else if constexpr (std::is_arithmetic<T>::value && sizeof(T) == 1) {
+        const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
+        uint8_t* d = reinterpret_cast<uint8_t*>(dst);
+        if (slice_3d_detail::cpu_has_avx2()) {
+            done = slice_3d_detail::strided_copy_8_avx2(s, step, count, d);
+        } else if (slice_3d_detail::cpu_has_ssse3()) {
+            done = slice_3d_detail::strided_copy_8_ssse3(s, step, count, d);
+        }
+    }
+    src += static_cast<std::ptrdiff_t>(done) * step;
+    dst += done;
+    count -= done;
+#endif
+    slice_3d_detail::strided_copy_scalar(src, step, count, dst);
+}
+
+template <typename T>
+void strided_store(const T* src, std::ptrdiff_t step, size_t count, T* dst) {
+    if (count == 0) {
+        return;
+    }
+    if (step == 1) {
+        std::copy(src, src + count, dst);
+        return;
+    }
+    if (step == -1) {
+        // dst[-i] = src[i] is a reversed copy into [dst - (count - 1), dst].
+        strided_copy(src + (count - 1), -1, count, dst - static_cast<std::ptrdiff_t>(count - 1));
+        return;
+    }
+    for (size_t i = 0; i < count; ++i, dst += step) {
+        *dst = src[i];
+    }
+}
+
+inline const char* strided_copy_isa() {
+#ifdef SLICE_3D_X86_SIMD
+    if (slice_3d_detail::cpu_has_avx2()) {
+        return "avx2";
+    }
+    // 4- and 8-byte types use SSE2 either way; SSSE3 adds the 1- and 2-byte kernels.
+    return slice_3d_detail::cpu_has_ssse3() ? "ssse3" : "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+#endif // STRIDED_COPY_TPP
@@ -0,0 +1,388 @@
+// tests/bench_slice.cpp
+#include "../src/slice_3d.h"
+#include "../src/slice_plan.h"
+#include "../src/slice_3d_parallel.h"
+#include "../src/strided_copy.h"
+#include "../src/slice_io.h"
+#include "../src/slice_stream.h"
+#include "../src/slice_fused.h"
+#include "../src/slice_stats.h"
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// --- Benchmark Patterns ---
+struct BenchPattern {
+    std::string name;
+    int start0, stop0, start1, stop1, start2, stop2;
+};
+
+// Best-of-N wall time in seconds.
+template <typename Fn>
+double time_best(Fn&& fn, int repeats) {
+    double best = 1e30;
+    for (int r = 0; r < repeats; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+// Mean seconds per call of fn, best of `repeats` batches of `iters` calls.
+// Batching keeps clock overhead out of the per-op time of small slices.
+template <typename Fn>
+double time_per_op(Fn&& fn, size_t iters, int repeats) {
+    return time_best([&]() { for (size_t i = 0; i < iters; ++i) fn(); }, repeats) / static_cast<double>(iters);
+}
+
+// --- Shape x dtype x pattern sweep ---
+struct SweepShape {
+    std::string name;
+    size_t dim0, dim1, dim2;
+};
+
+struct SweepPattern {
+    std::string name;
+    int start0, stop0, step0, start1, stop1, step1, start2, stop2, step2;
+};
+
+template <typename T>
+void bench_sweep_type(const std::string& dtype, const std::vector<SweepShape>& shapes) {
+    const int N = SLICE_NONE;
+    // One pattern per SlicePath, plus a reversal.
+    const std::vector<SweepPattern> patterns = {
+        {"[1:-1, :, :]", 1, -1, 1, N, N, 1, N, N, 1},
+        {"[:, 1:-1, :]", N, N, 1, 1, -1, 1, N, N, 1},
+        {"[:, :, 1:-1]", N, N, 1, N, N, 1, 1, -1, 1},
+        {"[1:-1, 1:-1, 1:-1]", 1, -1, 1, 1, -1, 1, 1, -1, 1},
+        {"[:, ::2, ::2]", N, N, 1, N, N, 2, N, N, 2},
+        {"[:, :, ::-1]", N, N, 1, N, N, 1, N, N, -1},
+    };
+
+    for (const auto& shape : shapes) {
+        std::vector<T> data(shape.dim0 * shape.dim1 * shape.dim2);
+        for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<T>(i % 100);
+        std::vector<T> out(data.size());
+        std::vector<T> copy_dst(data.size());
+
+        for (const auto& p : patterns) {
+            const SlicePlan plan(shape.dim0, shape.dim1, shape.dim2,
+                                 p.start0, p.stop0, p.step0,
+                                 p.start1, p.stop1, p.step1,
+                                 p.start2, p.stop2, p.step2);
+            const size_t out_bytes = plan.output_size() * sizeof(T);
+            // Roughly 64 MiB of output per timed batch.
+            const size_t iters = std::max<size_t>(1, (size_t(64) << 20) / std::max<size_t>(1, out_bytes));
+
+            const double plan_secs = time_per_op([&]() { plan.execute(data.data(), out.data()); }, iters, 5);
+            const double api_secs = time_per_op([&]() {
+                auto result = slice_3d_optimized(data, shape.dim0, shape.dim1, shape.dim2,
+                                                 p.start0, p.stop0, p.step0,
+                                                 p.start1, p.stop1, p.step1,
+                                                 p.start2, p.stop2, p.step2);
+                if (result.size() != plan.output_size()) std::abort();
+            }, std::max<size_t>(1, iters / 4), 3);
+            // Roofline: one memcpy of the same number of output bytes.
+            const double memcpy_secs = time_per_op([&]() {
+                std::memcpy(copy_dst.data(), data.data(), out_bytes);
+            }, iters, 5);
+
+            std::cout << std::left << std::setw(8) << shape.name << std::setw(8) << dtype
+                      << std::setw(22) << p.name << std::setw(12) << slice_path_name(plan.kernel()) << std::right
+                      << std::fixed << std::setprecision(1)
+                      << std::setw(14) << plan_secs * 1e9
+                      << std::setw(14) << api_secs * 1e9
+                      << std::setw(10) << std::setprecision(2) << 2.0 * out_bytes / plan_secs / 1e9
+                      << std::setw(10) << std::setprecision(1) << 100.0 * memcpy_secs / plan_secs << "\n";
+        }
+    }
+}
+
+// ns/op of SlicePlan::execute (copy only) and slice_3d_optimized (plus
+// normalization and allocation), GB/s counted as bytes read + written, and
+// plan throughput as a percentage of memcpy of the same output size.
+void bench_sweep() {
+    const std::vector<SweepShape> shapes = {
+        {"small", 8, 16, 32},        // Per-call overhead dominates.
+        {"cube", 128, 128, 128},     // 2-16 MiB depending on dtype.
+        {"thin", 4096, 32, 8},       // Short rows: many tiny runs.
+        {"wide", 16, 64, 4096},      // Long rows.
+    };
+    std::cout << "Sweep (shape x dtype x pattern)\n";
+    std::cout << std::left << std::setw(8) << "shape" << std::setw(8) << "dtype"
+              << std::setw(22) << "pattern" << std::setw(12) << "path" << std::right
+              << std::setw(14) << "plan ns/op" << std::setw(14) << "api ns/op"
+              << std::setw(10) << "GB/s" << std::setw(10) << "%memcpy" << "\n";
+    bench_sweep_type<int16_t>("int16", shapes);
+    bench_sweep_type<float>("float", shapes);
+    bench_sweep_type<double>("double", shapes);
+    std::cout << "\n";
+}
+
+// Thread scaling of SlicePlan::execute on one large float volume.
+void bench_thread_scaling() {
+    const size_t dim0 = 256, dim1 = 256, dim2 = 512; // 128 MiB of float
+    const int d0 = static_cast<int>(dim0), d1 = static_cast<int>(dim1), d2 = static_cast<int>(dim2);
+    const std::vector<BenchPattern> patterns = {
+        {"[1:-1, :, :]", 1, -1, 0, d1, 0, d2},
+        {"[:, 1:-1, :]", 0, d0, 1, -1, 0, d2},
+        {"[:, :, 1:-1]", 0, d0, 0, d1, 1, -1},
+        {"[1:-1, 1:-1, :]", 1, -1, 1, -1, 0, d2},
+        {"[1:-1, 1:-1, 1:-1]", 1, -1, 1, -1, 1, -1},
+    };
+
+    std::vector<float> data(dim0 * dim1 * dim2);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<float>(i % 1000);
+
+    // 1, 2, 4, ... up to and including the hardware thread count.
+    const size_t max_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    std::vector<size_t> thread_counts;
+    for (size_t t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+    thread_counts.push_back(max_threads);
+    std::cout << "Thread scaling (" << dim0 << "x" << dim1 << "x" << dim2 << " float, "
+              << max_threads << " hardware threads)\n";
+    std::cout << std::left << std::setw(22) << "pattern" << std::right
+              << std::setw(9) << "threads" << std::setw(12) << "ms"
+              << std::setw(10) << "GB/s" << std::setw(10) << "speedup" << "\n";
+
+    for (const auto& p : patterns) {
+        const SlicePlan plan(dim0, dim1, dim2, p.start0, p.stop0, p.start1, p.stop1, p.start2, p.stop2);
+        std::vector<float> out(plan.output_size());
+        // Bytes read + bytes written.
+        const double bytes = 2.0 * plan.output_size() * sizeof(float);
+
+        double serial = 0.0;
+        for (size_t threads : thread_counts) {
+            ParallelPolicy policy;
+            policy.num_threads = threads;
+            const double secs = time_best([&]() { plan.execute(data.data(), out.data(), policy); }, 5);
+            if (threads == 1) serial = secs;
+            std::cout << std::left << std::setw(22) << p.name << std::right
+                      << std::setw(9) << threads
+                      << std::setw(12) << std::fixed << std::setprecision(3) << secs * 1e3
+                      << std::setw(10) << std::setprecision(2) << bytes / secs / 1e9
+                      << std::setw(10) << std::setprecision(2) << serial / secs << "\n";
+        }
+    }
+    std::cout << "\n";
+}
+
+// Innermost-axis strided kernels: SIMD dispatch vs the scalar loop. The
+// large count is bound by memory bandwidth for every kernel; the small one
+// stays in cache and shows the kernels themselves.
+template <typename T>
+void bench_strided_copy_type(const std::string& dtype, size_t count) {
+    const std::vector<std::ptrdiff_t> steps = {-1, 2, 3, 4};
+    std::vector<T> src(count * 4 + 1);
+    for (size_t i = 0; i < src.size(); ++i) src[i] = static_cast<T>(i % 100);
+    std::vector<T> dst(count);
+    const size_t iters = std::max<size_t>(1, (size_t(1) << 20) / count);
+
+    for (std::ptrdiff_t step : steps) {
+        const T* first = step < 0 ? src.data() + count - 1 : src.data();
+        const double simd = time_per_op([&]() { strided_copy(first, step, count, dst.data()); }, iters, 20);
+        const double scalar = time_per_op([&]() {
+            slice_3d_detail::strided_copy_scalar(first, step, count, dst.data());
+        }, iters, 20);
+        std::cout << std::left << std::setw(8) << dtype << std::right << std::setw(10) << count << std::setw(6) << step
+                  << std::setw(14) << std::fixed << std::setprecision(3) << simd * 1e6
+                  << std::setw(14) << scalar * 1e6
+                  << std::setw(10) << std::setprecision(2) << scalar / simd << "\n";
+    }
+}
+
+void bench_strided_copy() {
+    std::cout << "Strided copy (dispatch: " << strided_copy_isa() << ")\n";
+    std::cout << std::left << std::setw(8) << "dtype" << std::right << std::setw(10) << "count" << std::setw(6) << "step"
+              << std::setw(14) << "simd us" << std::setw(14) << "scalar us" << std::setw(10) << "speedup" << "\n";
+    for (size_t count : {size_t(1) << 20, size_t(1) << 12}) {
+        bench_strided_copy_type<int8_t>("int8", count);
+        bench_strided_copy_type<int16_t>("int16", count);
+        bench_strided_copy_type<float>("float", count);
+        bench_strided_copy_type<double>("double", count);
+    }
+    std::cout << "\n";
+}
+
+// Text vs binary vs .npy load, and a small ROI read through mmap.
+void bench_io() {
+    const size_t dim0 = 64, dim1 = 256, dim2 = 256; // 16 MiB of float
+    std::vector<float> data(dim0 * dim1 * dim2);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<float>(i % 1000) * 0.25f;
+
+    const std::string base = "./build/bench_io";
+    save_vector_to_file(data, base + ".txt");
+    save_vector_to_binary(data, base + ".bin");
+    save_npy(data, {dim0, dim1, dim2}, base + ".npy");
+
+    const double text = time_best([&]() { load_vector_from_file<float>(base + ".txt"); }, 1);
+    const double binary = time_best([&]() { load_vector_from_binary<float>(base + ".bin"); }, 3);
+    const double npy = time_best([&]() { load_npy<float>(base + ".npy"); }, 3);
+    const double mapped_roi = time_best([&]() {
+        auto mapped = open_npy_mapped<float>(base + ".npy");
+        mapped.slice(std::array<int, 3>{10, 0, 0}, std::array<int, 3>{12, 32, 32});
+    }, 3);
+
+    std::cout << "I/O (" << dim0 << "x" << dim1 << "x" << dim2 << " float)\n";
+    std::cout << std::left << std::setw(34) << "operation" << std::right << std::setw(12) << "ms" << "\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(34) << "load text" << std::right << std::setw(12) << text * 1e3 << "\n";
+    std::cout << std::left << std::setw(34) << "load raw binary" << std::right << std::setw(12) << binary * 1e3 << "\n";
+    std::cout << std::left << std::setw(34) << "load .npy" << std::right << std::setw(12) << npy * 1e3 << "\n";
+    std::cout << std::left << std::setw(34) << "mmap .npy + slice [10:12, :32, :32]" << std::right
+              << std::setw(12) << mapped_roi * 1e3 << "\n\n";
+
+    std::remove((base + ".txt").c_str());
+    std::remove((base + ".bin").c_str());
+    std::remove((base + ".npy").c_str());
+}
+
+// Drops the file's pages from the page cache so the next read hits the disk.
+void evict_page_cache(const std::string& filename) {
+#if defined(POSIX_FADV_DONTNEED)
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+#else
+    (void)filename;
+#endif
+}
+
+// Best-of-N wall time with the page cache for filename evicted before each run.
+template <typename Fn>
+double time_best_cold(const std::string& filename, Fn&& fn, int repeats) {
+    double best = 1e30;
+    for (int r = 0; r < repeats; ++r) {
+        evict_page_cache(filename);
+        best = std::min(best, time_best(fn, 1));
+    }
+    return best;
+}
+
+// Streaming slice throughput against a plain sequential read of the file,
+// with a warm page cache (memory bound) and a cold one (disk bound, where the
+// double-buffered reader overlaps I/O with slicing and the sink). The sink
+// sums the output so there is consumer work to overlap.
+void bench_stream() {
+    const size_t dim0 = 128, dim1 = 256, dim2 = 512; // 64 MiB of float
+    const std::string filename = "./build/bench_stream.npy";
+    {
+        std::vector<float> data(dim0 * dim1 * dim2);
+        for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<float>(i % 1000);
+        save_npy(data, {dim0, dim1, dim2}, filename);
+    }
+    const double file_bytes = static_cast<double>(dim0 * dim1 * dim2 * sizeof(float));
+
+    auto sequential = [&]() {
+        std::ifstream file(filename, std::ios::binary);
+        std::vector<char> buf(size_t(8) << 20);
+        while (file.read(buf.data(), static_cast<std::streamsize>(buf.size())) || file.gcount() > 0) {}
+    };
+
+    const int N = SLICE_NONE;
+    double checksum = 0.0;
+    auto sink = [&checksum](const float* data, size_t n) {
+        for (size_t i = 0; i < n; ++i) checksum += data[i];
+    };
+    StreamOptions double_buffered;
+    StreamOptions single_buffered;
+    single_buffered.double_buffer = false;
+    auto stream_db = [&]() { slice_npy_stream<float>(filename, N, N, 1, N, N, 1, 1, -1, 1, sink, double_buffered); };
+    auto stream_sb = [&]() { slice_npy_stream<float>(filename, N, N, 1, N, N, 1, 1, -1, 1, sink, single_buffered); };
+
+    struct Row {
+        const char* name;
+        double warm, cold;
+    };
+    const Row rows[] = {
+        {"sequential read", time_best(sequential, 3), time_best_cold(filename, sequential, 3)},
+        {"stream double-buffered", time_best(stream_db, 3), time_best_cold(filename, stream_db, 3)},
+        {"stream single-buffered", time_best(stream_sb, 3), time_best_cold(filename, stream_sb, 3)},
+    };
+
+    std::cout << "Streaming [:, :, 1:-1] from .npy (" << dim0 << "x" << dim1 << "x" << dim2 << " float, "
+              << (double_buffered.max_buffer_bytes >> 20) << " MiB budget)\n";
+    std::cout << std::left << std::setw(26) << "mode" << std::right << std::setw(12) << "warm ms"
+              << std::setw(10) << "GB/s" << std::setw(12) << "cold ms" << std::setw(10) << "GB/s" << "\n";
+    std::cout << std::fixed;
+    for (const Row& row : rows) {
+        std::cout << std::left << std::setw(26) << row.name << std::right
+                  << std::setw(12) << std::setprecision(3) << row.warm * 1e3
+                  << std::setw(10) << std::setprecision(2) << file_bytes / row.warm / 1e9
+                  << std::setw(12) << std::setprecision(3) << row.cold * 1e3
+                  << std::setw(10) << std::setprecision(2) << file_bytes / row.cold / 1e9 << "\n";
+    }
+    if (checksum < 0) std::cout << checksum;  // Keeps the sink's work observable.
+    std::cout << "\n";
+    std::remove(filename.c_str());
+}
+
+// Fused int16 -> float normalize (+ transpose) vs slicing then a second pass.
+void bench_fused() {
+    const size_t dim0 = 64, dim1 = 512, dim2 = 512; // 32 MiB of int16
+    const int N = SLICE_NONE;
+    std::vector<int16_t> data(dim0 * dim1 * dim2);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<int16_t>(i % 4000);
+    const float scale = 1.0f / 4000.0f, offset = -0.5f;
+
+    const double two_pass = time_best([&]() {
+        auto sliced = slice_3d_optimized(data, dim0, dim1, dim2, N, N, 1, 1, -1, 1, 1, -1, 1);
+        std::vector<float> out(sliced.size());
+        for (size_t i = 0; i < sliced.size(); ++i) out[i] = static_cast<float>(sliced[i]) * scale + offset;
+    }, 3);
+    const double fused = time_best([&]() {
+        slice_3d_affine<float>(data, dim0, dim1, dim2, N, N, 1, 1, -1, 1, 1, -1, 1, scale, offset);
+    }, 3);
+
+    // Transpose (0, 2, 1): naive scattered writes vs the tiled fused kernel.
+    const double naive_transpose = time_best([&]() {
+        std::vector<float> out(data.size());
+        for (size_t a = 0; a < dim0; ++a)
+            for (size_t b = 0; b < dim1; ++b)
+                for (size_t c = 0; c < dim2; ++c)
+                    out[(a * dim2 + c) * dim1 + b] = static_cast<float>(data[(a * dim1 + b) * dim2 + c]) * scale + offset;
+    }, 3);
+    const double tiled_transpose = time_best([&]() {
+        slice_3d_affine<float>(data, dim0, dim1, dim2, N, N, 1, N, N, 1, N, N, 1, scale, offset, {0, 2, 1});
+    }, 3);
+
+    std::cout << "Fused slice + int16->float affine (" << dim0 << "x" << dim1 << "x" << dim2 << ")\n";
+    std::cout << std::left << std::setw(34) << "operation" << std::right << std::setw(12) << "ms" << "\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(34) << "[:, 1:-1, 1:-1] slice, then convert" << std::right << std::setw(12) << two_pass * 1e3 << "\n";
+    std::cout << std::left << std::setw(34) << "[:, 1:-1, 1:-1] fused" << std::right << std::setw(12) << fused * 1e3 << "\n";
+    std::cout << std::left << std::setw(34) << "transpose(0, 2, 1) naive" << std::right << std::setw(12) << naive_transpose * 1e3 << "\n";
+    std::cout << std::left << std::setw(34) << "transpose(0, 2, 1) fused, tiled" << std::right << std::setw(12) << tiled_transpose * 1e3 << "\n\n";
+}
+
+int main() {
+    bench_sweep();
+    bench_thread_scaling();
+    bench_strided_copy();
+    bench_io();
+    bench_stream();
+    bench_fused();
+
+    // Per run-length and per-path totals for everything above (make bench_stats).
+    std::cout << "Slice stats\n";
+    print_slice_stats(std::cout);
+    return 0;
+}
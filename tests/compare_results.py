@@ -7,8 +7,30 @@ DATA_DIR = "./data"
 CPP_OUTPUT_DIR = "./data/cpp_outputs"
 PY_OUTPUT_DIR = "./data/python_outputs"
 
+def load_and_compare_npy(file1, file2):
+    """Load two .npy files and require identical dtype, shape and values."""
+    try:
+        arr1 = np.load(file1)
+        arr2 = np.load(file2)
+    except Exception as e:
+        print(f"  ERROR loading files {file1} or {file2}: {e}")
+        return False
+
+    if arr1.dtype != arr2.dtype:
+        print(f"  FAIL: dtype mismatch {arr1.dtype} vs {arr2.dtype}")
+        return False
+    if arr1.shape != arr2.shape:
+        print(f"  FAIL: Shape mismatch {arr1.shape} vs {arr2.shape}")
+        return False
+    if not np.array_equal(arr1, arr2):
+        print(f"  FAIL: Value mismatch found at {np.count_nonzero(arr1 != arr2)} indices.")
+        return False
+    return True
+
 def load_and_compare(file1, file2, tolerance=1e-6):
     """Load two flat files and compare arrays."""
+    if file1.endswith(".npy"):
+        return load_and_compare_npy(file1, file2)
     try:
         # Load data
         # Assume float for simplicity in comparison, adjust dtype if needed
@@ -43,6 +43,10 @@ def generate_and_save_data():
         fmt_str = '%.8f' if np.issubdtype(dtype, np.floating) else '%d'
         np.savetxt(filename, flat_data, fmt=fmt_str)
         print(f"    Saved to {filename}")
+        # Same array as .npy (keeps shape and dtype) for the binary I/O tests
+        npy_filename = os.path.join(DATA_DIR, f"{name}_data.npy")
+        np.save(npy_filename, data)
+        print(f"    Saved to {npy_filename}")
 
     print("Step 1 completed.\n")
 
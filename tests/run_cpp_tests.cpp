@@ -1,8 +1,17 @@
 // tests/run_cpp_tests.cpp
 #include "../src/slice_3d.h"
+#include "../src/slice_3d_view.h"
+#include "../src/slice_plan.h"
+#include "../src/slice_3d_parallel.h"
+#include "../src/slice_nd.h"
+#include "../src/slice_io.h"
+#include "../src/slice_stream.h"
+#include "../src/slice_fused.h"
+#include "../src/slice_roi.h"
 #include <iostream>
 #include <vector>
 #include <string>
+#include <cstdint>
 #include <filesystem>
 #include <algorithm> // for std::min, std::max
 
@@ -149,6 +158,267 @@ void run_single_test_case(const TestCase& test_case) {
             save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_complex_multidim_tail.txt");
         }
 
+        // Zero-copy Views
+        {
+            auto view = slice_3d_view<T>(data, test_case.dim0, test_case.dim1, test_case.dim2, 1, 3, 1, 3, 1, 4);
+            save_vector_to_file<T>(view.materialize(), OUTPUT_DIR + "/" + test_case.name + "_py_view_multidim_13_13_14.txt");
+        }
+        {
+            auto view = slice_3d_view<T>(data, test_case.dim0, test_case.dim1, test_case.dim2,
+                                         1, static_cast<int>(test_case.dim0),
+                                         0, static_cast<int>(test_case.dim1),
+                                         1, static_cast<int>(test_case.dim2));
+            auto sub = view.subview(0, 2, 1, static_cast<int>(view.shape(1)), 0, -1);
+            save_vector_to_file<T>(sub.materialize(), OUTPUT_DIR + "/" + test_case.name + "_py_view_subview_chain.txt");
+        }
+        {
+            auto view = slice_3d_view<T>(data, test_case.dim0, test_case.dim1, test_case.dim2,
+                                         -2, static_cast<int>(test_case.dim0),
+                                         -1, static_cast<int>(test_case.dim1),
+                                         -3, static_cast<int>(test_case.dim2));
+            std::vector<T> result;
+            for (size_t i = 0; i < view.shape(0); ++i)
+                for (size_t j = 0; j < view.shape(1); ++j)
+                    for (size_t k = 0; k < view.shape(2); ++k)
+                        result.push_back(view(i, j, k));
+            save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_view_element_access.txt");
+        }
+
+        // Reusable Plans
+        {
+            SlicePlan plan(test_case.dim0, test_case.dim1, test_case.dim2, 1, 3, 1, 3, 1, 4);
+            std::vector<T> result;
+            plan.execute(data, result);
+            save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_plan_multidim_13_13_14.txt");
+        }
+        {
+            SlicePlan plan(test_case.dim0, test_case.dim1, test_case.dim2,
+                           0, static_cast<int>(test_case.dim0), 2, 6, 0, static_cast<int>(test_case.dim2));
+            std::vector<T> result(plan.output_size());
+            plan.execute(data.data(), data.size(), result.data(), result.size());
+            save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_plan_dim1_2to6.txt");
+        }
+        {
+            // Two inputs back-to-back: the data, then its negation.
+            SlicePlan plan(test_case.dim0, test_case.dim1, test_case.dim2, -2, -1, -3, -1, -4, -2);
+            std::vector<T> batch(data);
+            for (const T& v : data) batch.push_back(static_cast<T>(-v));
+            std::vector<T> result(2 * plan.output_size());
+            plan.execute_batch(batch.data(), result.data(), 2);
+            save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_plan_batch_negated.txt");
+        }
+
+        // Parallel Execution (threshold 0 forces the threaded path on small inputs)
+        {
+            ParallelPolicy policy;
+            policy.num_threads = 3;
+            policy.min_parallel_bytes = 0;
+            {
+                auto result = slice_3d_optimized<T>(data, test_case.dim0, test_case.dim1, test_case.dim2,
+                                                    1, 3, 1, 3, 1, 4, policy);
+                save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_parallel_multidim_13_13_14.txt");
+            }
+            {
+                auto result = slice_3d_optimized<T>(data, test_case.dim0, test_case.dim1, test_case.dim2,
+                                                    0, static_cast<int>(test_case.dim0), 2, 6, 0, static_cast<int>(test_case.dim2), policy);
+                save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_parallel_dim1_2to6.txt");
+            }
+            {
+                auto result = slice_3d_optimized<T>(data, test_case.dim0, test_case.dim1, test_case.dim2,
+                                                    1, 4, 0, static_cast<int>(test_case.dim1), 0, static_cast<int>(test_case.dim2), policy);
+                save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_parallel_dim0_1to4.txt");
+            }
+            {
+                auto result = slice_3d_last_dim_from<T>(data, test_case.dim0, test_case.dim1, test_case.dim2, 2, policy);
+                save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_parallel_dim2_from2.txt");
+            }
+        }
+
+        // Stepped Slices (N = SLICE_NONE, i.e. an omitted bound)
+        {
+            const int N = SLICE_NONE;
+            const size_t d0 = test_case.dim0, d1 = test_case.dim1, d2 = test_case.dim2;
+            save_vector_to_file<T>(slice_3d_optimized<T>(data, d0, d1, d2, N, N, 2, N, N, 1, N, N, -1),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_step_2_all_rev.txt");
+            save_vector_to_file<T>(slice_3d_optimized<T>(data, d0, d1, d2, N, N, 1, N, N, 4, N, N, 4),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_step_downsample_4.txt");
+            save_vector_to_file<T>(slice_3d_optimized<T>(data, d0, d1, d2, N, N, -1, N, N, -1, N, N, -1),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_step_reverse_all.txt");
+            save_vector_to_file<T>(slice_3d_optimized<T>(data, d0, d1, d2, 1, -1, 3, N, N, -2, 5, 0, -2),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_step_mixed.txt");
+            save_vector_to_file<T>(slice_3d_optimized<T>(data, d0, d1, d2, N, N, 1, N, N, 1, N, N, 2),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_step_2_last.txt");
+            save_vector_to_file<T>(slice_3d_optimized<T>(data, d0, d1, d2, -1, N, -3, 100, -100, -1, -2, N, -5),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_step_clipped_negative.txt");
+            save_vector_to_file<T>(slice_3d_optimized<T>(data, d0, d1, d2, 1, 3, 1, 1, 3, 1, 1, 4, 1),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_step_unit_explicit.txt");
+
+            auto view = slice_3d_view<T>(data, d0, d1, d2, N, N, -1, N, N, 1, N, N, 1).subview(N, N, 1, N, N, 2, 1, N, 3);
+            save_vector_to_file<T>(view.materialize(), OUTPUT_DIR + "/" + test_case.name + "_py_step_view_chain.txt");
+
+            SlicePlan plan(d0, d1, d2, N, N, 1, N, N, 2, N, N, 2);
+            std::vector<T> result;
+            plan.execute(data, result);
+            save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_step_plan_2_2.txt");
+
+            ParallelPolicy policy;
+            policy.num_threads = 3;
+            policy.min_parallel_bytes = 0;
+            save_vector_to_file<T>(slice_3d_optimized<T>(data, d0, d1, d2, N, N, -1, N, N, 1, N, N, 3, policy),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_step_parallel.txt");
+        }
+
+        // N-dimensional Slices (same data viewed with other ranks)
+        {
+            const int N = SLICE_NONE;
+            const size_t d0 = test_case.dim0, d1 = test_case.dim1, d2 = test_case.dim2;
+            save_vector_to_file<T>(slice_nd<T, 1>(data, {d0 * d1 * d2}, {5}, {-5}, {3}),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_nd_1d_step3.txt");
+            save_vector_to_file<T>(slice_nd<T, 2>(data, {d0 * d1, d2}, {1, N}, {-1, N}, {1, 2}),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_nd_2d.txt");
+            save_vector_to_file<T>(slice_nd<T, 4>(data, {d0, d1, 1, d2}, {1, 0, 0, 1}, {N, 2, N, N}),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_nd_4d.txt");
+            save_vector_to_file<T>(slice_nd<T, 4>(data, {d0, d1, 1, d2}, {N, N, N, N}, {N, N, N, N}, {-1, -1, 1, -1}),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_nd_4d_reverse.txt");
+            save_vector_to_file<T>(slice_3d_optimized<T>(data, d0, d1, d2, 1, 3, 1, 3, 0, static_cast<int>(d2)),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_nd_coalesce_13_13_full.txt");
+            save_vector_to_file<T>(slice_nd<T, 3>(data, {d0, d1, d2}, {N, N, N}, {N, N, N}, {2, 1, 1}),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_nd_step2_planes.txt");
+        }
+
+        // Narrow dtypes (1/2-byte strided kernels), index-derived int16 / int8 data
+        {
+            const int N = SLICE_NONE;
+            const size_t d0 = test_case.dim0, d1 = test_case.dim1, d2 = test_case.dim2;
+            const size_t n = d0 * d1 * d2;
+            std::vector<int16_t> i16(n);
+            std::vector<int8_t> i8(n);
+            for (size_t i = 0; i < n; ++i) {
+                i16[i] = static_cast<int16_t>(static_cast<int>(i % 32749) - 16374);
+                i8[i] = static_cast<int8_t>(static_cast<int>(i % 251) - 125);
+            }
+            auto widen = [](const auto& v) { return std::vector<int>(v.begin(), v.end()); };
+            const std::string prefix = OUTPUT_DIR + "/" + test_case.name + "_py_narrow_";
+            save_vector_to_file<int>(widen(slice_nd<int16_t, 1>(i16, {n}, {N}, {N}, {-1})), prefix + "i16_rev.txt");
+            save_vector_to_file<int>(widen(slice_nd<int16_t, 1>(i16, {n}, {1}, {N}, {2})), prefix + "i16_step2.txt");
+            save_vector_to_file<int>(widen(slice_nd<int16_t, 1>(i16, {n}, {N}, {N}, {4})), prefix + "i16_step4.txt");
+            save_vector_to_file<int>(widen(slice_3d_optimized<int16_t>(i16, d0, d1, d2, N, N, -1, N, N, 1, N, N, 2)),
+                                     prefix + "i16_3d.txt");
+            save_vector_to_file<int>(widen(slice_nd<int8_t, 1>(i8, {n}, {N}, {N}, {-1})), prefix + "i8_rev.txt");
+            save_vector_to_file<int>(widen(slice_nd<int8_t, 1>(i8, {n}, {1}, {N}, {2})), prefix + "i8_step2.txt");
+            save_vector_to_file<int>(widen(slice_nd<int8_t, 1>(i8, {n}, {N}, {N}, {4})), prefix + "i8_step4.txt");
+            save_vector_to_file<int>(widen(slice_3d_optimized<int8_t>(i8, d0, d1, d2, N, N, 1, N, N, -1, N, N, -1)),
+                                     prefix + "i8_3d.txt");
+        }
+
+        // Binary / .npy I/O and memory-mapped slicing
+        {
+            const int N = SLICE_NONE;
+            const size_t d0 = test_case.dim0, d1 = test_case.dim1, d2 = test_case.dim2;
+            const std::string npy_filename = DATA_DIR + "/" + test_case.name + "_data.npy";
+            auto mapped = open_npy_mapped<T>(npy_filename);
+            if (mapped.shape() != std::vector<size_t>{d0, d1, d2}) {
+                throw std::runtime_error("Unexpected .npy shape in " + npy_filename);
+            }
+            {
+                const std::array<int, 3> starts = {1, N, -3}, stops = {3, N, N}, steps = {1, 2, 1};
+                const SliceNdPlan<3> plan({d0, d1, d2}, starts, stops, steps);
+                const auto& out_shape = plan.output_shape();
+                save_npy<T>(mapped.slice(starts, stops, steps),
+                            std::vector<size_t>(out_shape.begin(), out_shape.end()),
+                            OUTPUT_DIR + "/" + test_case.name + "_py_npy_mapped.npy");
+            }
+            save_vector_to_file<T>(mapped.view_3d().subview(-2, N, 1, 1, N, 1, N, N, -2).materialize(),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_npy_mapped_view.txt");
+
+            std::vector<size_t> shape;
+            auto loaded = load_npy<T>(npy_filename, &shape);
+            save_vector_to_file<T>(slice_3d_optimized<T>(loaded, shape[0], shape[1], shape[2], N, N, -1, 1, N, 1, N, 2, 1),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_npy_load.txt");
+
+            const std::string raw_filename = DATA_DIR + "/" + test_case.name + "_data.bin";
+            save_vector_to_binary<T>(data, raw_filename);
+            auto raw = open_binary_mapped<T>(raw_filename, {d0, d1, d2});
+            const std::array<int, 3> raw_starts = {N, -2, 1}, raw_stops = {N, N, N}, raw_steps = {1, 1, 2};
+            save_vector_to_file<T>(raw.slice(raw_starts, raw_stops, raw_steps),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_raw_mapped.txt");
+        }
+
+        // Out-of-core Streaming (tiny budget: one plane per chunk)
+        {
+            const int N = SLICE_NONE;
+            const std::string npy_filename = DATA_DIR + "/" + test_case.name + "_data.npy";
+            StreamOptions options;
+            options.max_buffer_bytes = 1;
+            {
+                std::vector<T> result;
+                slice_npy_stream<T>(npy_filename, 1, N, 1, N, N, 1, 1, -1, 1,
+                                    [&result](const T* d, size_t n) { result.insert(result.end(), d, d + n); },
+                                    options);
+                save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_stream_contiguous.txt");
+            }
+            {
+                std::vector<T> result;
+                slice_npy_stream<T>(npy_filename, N, N, -2, -1, 0, -2, N, N, 3,
+                                    [&result](const T* d, size_t n) { result.insert(result.end(), d, d + n); },
+                                    options);
+                save_vector_to_file<T>(result, OUTPUT_DIR + "/" + test_case.name + "_py_stream_strided.txt");
+            }
+            {
+                StreamOptions single;
+                single.double_buffer = false;
+                single.max_buffer_bytes = 3 * test_case.dim1 * test_case.dim2 * sizeof(T);
+                slice_npy_stream_to_npy<T>(npy_filename, OUTPUT_DIR + "/" + test_case.name + "_py_stream_npy.npy",
+                                           N, N, 1, 1, 3, 1, N, N, -1, single);
+            }
+        }
+
+        // Fused Slice + Convert / Affine / Permute
+        {
+            const int N = SLICE_NONE;
+            const size_t d0 = test_case.dim0, d1 = test_case.dim1, d2 = test_case.dim2;
+            save_vector_to_file<double>(slice_3d_convert<double>(data, d0, d1, d2, 1, 3, 1, N, N, 2, N, N, -1),
+                                        OUTPUT_DIR + "/" + test_case.name + "_py_fused_convert.txt");
+            save_vector_to_file<double>(slice_3d_affine<double>(data, d0, d1, d2, N, N, 1, 1, N, 1, N, N, 1, 0.5, 3.0),
+                                        OUTPUT_DIR + "/" + test_case.name + "_py_fused_affine.txt");
+            save_vector_to_file<T>(slice_3d_convert<T>(data, d0, d1, d2, N, N, 1, N, N, 1, N, N, 1, {2, 0, 1}),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_fused_transpose_201.txt");
+            save_vector_to_file<T>(slice_3d_convert<T>(data, d0, d1, d2, N, N, 1, 1, N, 1, N, -1, 1, {0, 2, 1}),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_fused_transpose_021.txt");
+            save_vector_to_file<T>(slice_3d_convert<T>(data, d0, d1, d2, N, N, -1, N, N, 1, N, N, 2, {1, 0, 2}),
+                                   OUTPUT_DIR + "/" + test_case.name + "_py_fused_transpose_102.txt");
+            save_vector_to_file<double>(slice_3d_affine<double>(data, d0, d1, d2, 1, N, 1, N, N, -1, 1, N, 1, -2.0, 1.0, {1, 2, 0}),
+                                        OUTPUT_DIR + "/" + test_case.name + "_py_fused_affine_120.txt");
+        }
+
+        // Multi-ROI Gather / Slice Assignment
+        {
+            const int N = SLICE_NONE;
+            const size_t d0 = test_case.dim0, d1 = test_case.dim1, d2 = test_case.dim2;
+            const std::vector<SliceRoi> rois = {
+                {0, 2, 1, 3, N, N},
+                {1, 3, 0, 2, 1, N},
+                {N, N, N, N, N, N, -1, 1, 2},
+                {2, 1, N, N, N, N},
+                {1, 2, 1, N, 1, 3},
+            };
+            auto batch = slice_3d_multi<T>(data, d0, d1, d2, rois);
+            save_vector_to_file<T>(batch.data, OUTPUT_DIR + "/" + test_case.name + "_py_roi_multi.txt");
+
+            auto assigned = data;
+            const size_t n_unit = std::min<size_t>(d0, 3) - std::min<size_t>(d0, 1);
+            std::vector<T> patch(n_unit * (d1 - std::min<size_t>(d1, 1)) * (d2 - std::min<size_t>(d2, 1)));
+            for (size_t i = 0; i < patch.size(); ++i) patch[i] = static_cast<T>(i) - static_cast<T>(7);
+            assign_slice_3d<T>(assigned, d0, d1, d2, 1, 3, 1, N, N, -1, patch);
+            save_vector_to_file<T>(assigned, OUTPUT_DIR + "/" + test_case.name + "_py_assign_unit.txt");
+
+            std::vector<T> stepped_patch(((d0 + 1) / 2) * d1 * (d2 / 2));
+            for (size_t i = 0; i < stepped_patch.size(); ++i) stepped_patch[i] = static_cast<T>(i) - static_cast<T>(7);
+            assigned = data;
+            assign_slice_3d<T>(assigned, d0, d1, d2, N, N, -2, N, N, -1, 1, N, 2, stepped_patch);
+            save_vector_to_file<T>(assigned, OUTPUT_DIR + "/" + test_case.name + "_py_assign_stepped.txt");
+        }
+
     } catch (const std::exception& e) {
         std::cerr << "    ERROR during C++ test for " << test_case.name << ": " << e.what() << "\n";
     }
@@ -160,7 +430,9 @@ int main() {
     fs::create_directories(OUTPUT_DIR);
 
     for (const auto& test_case : test_cases) {
-        if (test_case.name.find("float") != std::string::npos || test_case.name.find("double") != std::string::npos) {
+        if (test_case.name.find("double") != std::string::npos) {
+            run_single_test_case<double>(test_case);
+        } else if (test_case.name.find("float") != std::string::npos) {
             run_single_test_case<float>(test_case);
         } else if (test_case.name.find("int") != std::string::npos) {
             run_single_test_case<int>(test_case);
@@ -39,6 +39,22 @@ def run_single_test_case(name, dim0, dim1, dim2, dtype):
 
     # --- Define All Test Operations ---
     # Each operation is a tuple: (description, sliced_data, output_filename_suffix)
+    # Narrow dtypes: index-derived int16 / int8 data of the same shape
+    flat_index = np.arange(dim0 * dim1 * dim2)
+    flat_i16 = ((flat_index % 32749) - 16374).astype(np.int16)
+    flat_i8 = ((flat_index % 251) - 125).astype(np.int8)
+
+    # Multi-ROI gather: regions flattened back to back in request order
+    rois = [data_3d[0:2, 1:3, :], data_3d[1:3, 0:2, 1:], data_3d[::-1, ::1, ::2],
+            data_3d[2:1, :, :], data_3d[1:2, 1:, 1:3]]
+
+    # Slice assignment: patch values are arange(n) - 7 in the data's dtype
+    def assign(index):
+        assigned = data_3d.copy()
+        shape = assigned[index].shape
+        assigned[index] = (np.arange(int(np.prod(shape))) - 7).astype(data_3d.dtype).reshape(shape)
+        return assigned
+
     test_operations = [
         # Basic and Common Patterns
         ("[:, :, 2:]", data_3d[:, :, 2:], "dim2_from2"),
@@ -70,13 +86,98 @@ def run_single_test_case(name, dim0, dim1, dim2, dtype):
             data_3d[max(0,dim0-3):, max(0,dim1-2):, max(0,dim2-4):],
             "complex_multidim_tail"
         ),
+
+        # Zero-copy Views (C++ side goes through Slice3DView)
+        ("view [1:3, 1:3, 1:4]", data_3d[1:3, 1:3, 1:4], "view_multidim_13_13_14"),
+        ("view [1:, :, 1:][0:2, 1:, :-1]", data_3d[1:, :, 1:][0:2, 1:, :-1], "view_subview_chain"),
+        ("view [-2:, -1:, -3:] element access", data_3d[-2:, -1:, -3:], "view_element_access"),
+
+        # Reusable Plans (C++ side goes through SlicePlan)
+        ("plan [1:3, 1:3, 1:4]", data_3d[1:3, 1:3, 1:4], "plan_multidim_13_13_14"),
+        ("plan [:, 2:6, :]", data_3d[:, 2:6, :], "plan_dim1_2to6"),
+        ("plan batch [data, -data][-2:-1, -3:-1, -4:-2]",
+         np.concatenate([data_3d[-2:-1, -3:-1, -4:-2].flatten(), -data_3d[-2:-1, -3:-1, -4:-2].flatten()]),
+         "plan_batch_negated"),
+
+        # Parallel Execution (C++ side forces the threaded path)
+        ("parallel [1:3, 1:3, 1:4]", data_3d[1:3, 1:3, 1:4], "parallel_multidim_13_13_14"),
+        ("parallel [:, 2:6, :]", data_3d[:, 2:6, :], "parallel_dim1_2to6"),
+        ("parallel [1:4, :, :]", data_3d[1:4, :, :], "parallel_dim0_1to4"),
+        ("parallel [:, :, 2:]", data_3d[:, :, 2:], "parallel_dim2_from2"),
+
+        # Stepped Slices
+        ("[::2, :, ::-1]", data_3d[::2, :, ::-1], "step_2_all_rev"),
+        ("[:, ::4, ::4]", data_3d[:, ::4, ::4], "step_downsample_4"),
+        ("[::-1, ::-1, ::-1]", data_3d[::-1, ::-1, ::-1], "step_reverse_all"),
+        ("[1:-1:3, ::-2, 5:0:-2]", data_3d[1:-1:3, ::-2, 5:0:-2], "step_mixed"),
+        ("[:, :, ::2]", data_3d[:, :, ::2], "step_2_last"),
+        ("[-1::-3, 100:-100:-1, -2::-5]", data_3d[-1::-3, 100:-100:-1, -2::-5], "step_clipped_negative"),
+        ("[1:3:1, 1:3:1, 1:4:1]", data_3d[1:3:1, 1:3:1, 1:4:1], "step_unit_explicit"),
+        ("view [::-1][:, ::2, 1::3]", data_3d[::-1][:, ::2, 1::3], "step_view_chain"),
+        ("plan [:, ::2, ::2]", data_3d[:, ::2, ::2], "step_plan_2_2"),
+        ("parallel [::-1, :, ::3]", data_3d[::-1, :, ::3], "step_parallel"),
+
+        # N-dimensional Slices (same data viewed with other ranks)
+        ("1d [5:-5:3]", data_3d.reshape(-1)[5:-5:3], "nd_1d_step3"),
+        ("2d [1:-1, ::2]", data_3d.reshape(dim0 * dim1, dim2)[1:-1, ::2], "nd_2d"),
+        ("4d [1:, :2, :, 1:]", data_3d.reshape(dim0, dim1, 1, dim2)[1:, :2, :, 1:], "nd_4d"),
+        ("4d [::-1, ::-1, :, ::-1]", data_3d.reshape(dim0, dim1, 1, dim2)[::-1, ::-1, :, ::-1], "nd_4d_reverse"),
+        ("[1:3, 1:3, :]", data_3d[1:3, 1:3, :], "nd_coalesce_13_13_full"),
+        ("[::2, :, :]", data_3d[::2, :, :], "nd_step2_planes"),
+
+        # Narrow dtypes (1/2-byte strided kernels)
+        ("int16 [::-1]", flat_i16[::-1], "narrow_i16_rev"),
+        ("int16 [1::2]", flat_i16[1::2], "narrow_i16_step2"),
+        ("int16 [::4]", flat_i16[::4], "narrow_i16_step4"),
+        ("int16 [::-1, :, ::2]", flat_i16.reshape(dim0, dim1, dim2)[::-1, :, ::2], "narrow_i16_3d"),
+        ("int8 [::-1]", flat_i8[::-1], "narrow_i8_rev"),
+        ("int8 [1::2]", flat_i8[1::2], "narrow_i8_step2"),
+        ("int8 [::4]", flat_i8[::4], "narrow_i8_step4"),
+        ("int8 [:, ::-1, ::-1]", flat_i8.reshape(dim0, dim1, dim2)[:, ::-1, ::-1], "narrow_i8_3d"),
+
+        # Binary / .npy I/O and memory-mapped slicing
+        ("npy mapped view [-2:, 1:, ::-2]", data_3d[-2:, 1:, ::-2], "npy_mapped_view"),
+        ("npy load [::-1, 1:, :2]", data_3d[::-1, 1:, :2], "npy_load"),
+        ("raw mapped [:, -2:, 1::2]", data_3d[:, -2:, 1::2], "raw_mapped"),
+
+        # Out-of-core Streaming
+        ("stream [1:, :, 1:-1]", data_3d[1:, :, 1:-1], "stream_contiguous"),
+        ("stream [::-2, -1:0:-2, ::3]", data_3d[::-2, -1:0:-2, ::3], "stream_strided"),
+
+        # Fused Slice + Convert / Affine / Permute
+        ("convert [1:3, ::2, ::-1] -> float64", data_3d[1:3, ::2, ::-1].astype(np.float64), "fused_convert"),
+        ("affine [:, 1:, :] * 0.5 + 3", data_3d[:, 1:, :].astype(np.float64) * 0.5 + 3.0, "fused_affine"),
+        ("[:, :, :].transpose(2, 0, 1)", data_3d.transpose(2, 0, 1), "fused_transpose_201"),
+        ("[:, 1:, :-1].transpose(0, 2, 1)", data_3d[:, 1:, :-1].transpose(0, 2, 1), "fused_transpose_021"),
+        ("[::-1, :, ::2].transpose(1, 0, 2)", data_3d[::-1, :, ::2].transpose(1, 0, 2), "fused_transpose_102"),
+        ("([1:, ::-1, 1:] * -2 + 1).transpose(1, 2, 0)",
+         (data_3d[1:, ::-1, 1:].astype(np.float64) * -2.0 + 1.0).transpose(1, 2, 0), "fused_affine_120"),
+
+        # Multi-ROI Gather / Slice Assignment
+        ("rois concatenated", np.concatenate([r.flatten() for r in rois]), "roi_multi"),
+        ("a[1:3, 1:, :-1] = patch", assign(np.s_[1:3, 1:, :-1]), "assign_unit"),
+        ("a[::-2, ::-1, 1::2] = patch", assign(np.s_[::-2, ::-1, 1::2]), "assign_stepped"),
     ]
 
+    # Binary outputs: sliced from the full-precision .npy source, saved as
+    # .npy and compared including shape and dtype
+    npy_3d = np.load(os.path.join(DATA_DIR, f"{name}_data.npy"))
+    npy_operations = [
+        ("npy mapped [1:3, ::2, -3:]", npy_3d[1:3, ::2, -3:], "npy_mapped"),
+        ("stream to npy [:, 1:3, ::-1]", npy_3d[:, 1:3, ::-1], "stream_npy"),
+    ]
+    for desc, sliced_data, suffix in npy_operations:
+        out_filename = os.path.join(OUTPUT_DIR, f"{name}_py_{suffix}.npy")
+        try:
+            np.save(out_filename, np.ascontiguousarray(sliced_data))
+        except Exception as e:
+            print(f"    ERROR saving {desc} for {name}: {e}")
+
     # --- Execute and Save Results ---
     for desc, sliced_data, suffix in test_operations:
         out_filename = os.path.join(OUTPUT_DIR, f"{name}_py_{suffix}.txt")
         try:
-            fmt_str = '%.8f' if np.issubdtype(dtype, np.floating) else '%d'
+            fmt_str = '%.8f' if np.issubdtype(sliced_data.dtype, np.floating) else '%d'
             np.savetxt(out_filename, sliced_data.flatten(), fmt=fmt_str)
             # print(f"    Saved {desc} to {out_filename}") # Optional verbose output
         except Exception as e: